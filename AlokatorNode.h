@@ -0,0 +1,166 @@
+#ifndef ALOKATOR_NODE_H
+#define ALOKATOR_NODE_H
+
+#include <new>
+#include <utility>
+#include <type_traits>
+using namespace std;
+
+// ============================================================================
+// ALOKATOR NODE - POOL/SLAB UNTUK NODE STRUKTUR DATA
+// ============================================================================
+// Digunakan oleh: CircularLinkedList, Stack, Queue, BinarySearchTree
+// AlokatorPool : Node diambil dari blok memori besar yang bersebelahan,
+//                node yang dihapus didaur ulang lewat free list (default)
+// AlokatorHeap : Satu new/delete per node (perilaku lama)
+// ============================================================================
+
+template<typename NodeT>
+class AlokatorPool {
+private:
+    // Slot kosong dipakai ulang sebagai elemen free list
+    union Slot {
+        Slot* berikutnya;
+        typename aligned_storage<sizeof(NodeT), alignof(NodeT)>::type data;
+    };
+
+    // Header blok (blok disimpan sebagai linked list)
+    struct Blok {
+        Slot* slot;
+        Blok* berikutnya;
+    };
+
+    static const int KAPASITAS_AWAL = 32;
+    static const int KAPASITAS_MAKS = 65536;
+
+    Blok* daftarBlok;       // Blok terbaru di depan
+    Slot* freeList;         // Slot bekas node yang sudah dihapus
+    int terpakaiDiBlok;     // Jumlah slot blok terbaru yang sudah dibagikan
+    int kapasitasBlok;      // Kapasitas blok terbaru
+    int jumlahBlok;
+    int jumlahNodeAktif;
+
+    // Helper: Siapkan blok baru (kapasitas naik 2x sampai batas maksimal)
+    void tambahBlok() {
+        int kapasitasBaru = (daftarBlok == nullptr) ? KAPASITAS_AWAL : kapasitasBlok * 2;
+        if (kapasitasBaru > KAPASITAS_MAKS) kapasitasBaru = KAPASITAS_MAKS;
+
+        Slot* slotBaru = static_cast<Slot*>(::operator new(sizeof(Slot) * kapasitasBaru));
+        Blok* blokBaru;
+        try {
+            blokBaru = new Blok;
+        } catch (...) {
+            ::operator delete(slotBaru);
+            throw;
+        }
+        blokBaru->slot = slotBaru;
+        blokBaru->berikutnya = daftarBlok;
+
+        daftarBlok = blokBaru;
+        kapasitasBlok = kapasitasBaru;
+        terpakaiDiBlok = 0;
+        jumlahBlok++;
+    }
+
+    // Helper: Ambil satu slot kosong
+    Slot* ambilSlot() {
+        if (freeList != nullptr) {
+            Slot* slot = freeList;
+            freeList = freeList->berikutnya;
+            return slot;
+        }
+
+        if (daftarBlok == nullptr || terpakaiDiBlok >= kapasitasBlok) {
+            tambahBlok();
+        }
+
+        return &daftarBlok->slot[terpakaiDiBlok++];
+    }
+
+    // Helper: Kembalikan slot ke free list
+    void kembalikanSlot(Slot* slot) {
+        slot->berikutnya = freeList;
+        freeList = slot;
+    }
+
+public:
+    // Constructor
+    AlokatorPool()
+        : daftarBlok(nullptr), freeList(nullptr), terpakaiDiBlok(0),
+          kapasitasBlok(0), jumlahBlok(0), jumlahNodeAktif(0) {}
+
+    // Destructor - Node harus sudah di-dealokasi oleh container
+    ~AlokatorPool() {
+        while (daftarBlok != nullptr) {
+            Blok* temp = daftarBlok;
+            daftarBlok = daftarBlok->berikutnya;
+            ::operator delete(temp->slot);
+            delete temp;
+        }
+    }
+
+    // Pool dimiliki oleh satu container, tidak boleh di-copy
+    AlokatorPool(const AlokatorPool&) = delete;
+    AlokatorPool& operator=(const AlokatorPool&) = delete;
+
+    // Buat node baru di slot pool
+    // Jika constructor NodeT melempar exception, slot dikembalikan ke free list
+    template<typename... Args>
+    NodeT* alokasi(Args&&... args) {
+        Slot* slot = ambilSlot();
+        NodeT* node;
+        try {
+            node = new (&slot->data) NodeT(std::forward<Args>(args)...);
+        } catch (...) {
+            kembalikanSlot(slot);
+            throw;
+        }
+        jumlahNodeAktif++;
+        return node;
+    }
+
+    // Hancurkan node dan kembalikan slot ke free list
+    void dealokasi(NodeT* node) {
+        if (node == nullptr) return;
+
+        node->~NodeT();
+        kembalikanSlot(reinterpret_cast<Slot*>(node));
+        jumlahNodeAktif--;
+    }
+
+    // Statistik (untuk benchmark / debugging)
+    int getJumlahBlok() const { return jumlahBlok; }
+    int getJumlahNodeAktif() const { return jumlahNodeAktif; }
+};
+
+template<typename NodeT>
+class AlokatorHeap {
+private:
+    int jumlahNodeAktif;
+
+public:
+    AlokatorHeap() : jumlahNodeAktif(0) {}
+
+    AlokatorHeap(const AlokatorHeap&) = delete;
+    AlokatorHeap& operator=(const AlokatorHeap&) = delete;
+
+    template<typename... Args>
+    NodeT* alokasi(Args&&... args) {
+        NodeT* node = new NodeT(std::forward<Args>(args)...);
+        jumlahNodeAktif++;
+        return node;
+    }
+
+    void dealokasi(NodeT* node) {
+        if (node == nullptr) return;
+
+        delete node;
+        jumlahNodeAktif--;
+    }
+
+    // Setiap node adalah satu alokasi sistem
+    int getJumlahBlok() const { return jumlahNodeAktif; }
+    int getJumlahNodeAktif() const { return jumlahNodeAktif; }
+};
+
+#endif
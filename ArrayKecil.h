@@ -0,0 +1,237 @@
+#ifndef ARRAY_KECIL_H
+#define ARRAY_KECIL_H
+
+#include <new>
+#include <utility>
+#include <type_traits>
+using namespace std;
+
+// ============================================================================
+// ARRAY KECIL - SMALL-VECTOR DENGAN BUFFER INLINE
+// ============================================================================
+// Digunakan oleh: Transaksi (item booking per transaksi)
+// - N elemen pertama disimpan langsung di dalam objek (tanpa alokasi heap)
+// - Lebih dari N elemen: pindah ke SATU buffer heap bersebelahan (naik 2x)
+// - Tidak ada batas jumlah elemen selain memori
+// - Move dari buffer heap cukup memindahkan pointer (O(1)),
+//   dari buffer inline elemen di-move satu per satu
+// PENTING: Pointer/referensi ke elemen tidak valid lagi setelah tambah
+//          (buffer bisa pindah) atau hapus (elemen digeser)
+// ============================================================================
+
+template<typename T, int N>
+class ArrayKecil {
+private:
+    typedef typename aligned_storage<sizeof(T), alignof(T)>::type Penyimpanan;
+    
+    Penyimpanan bufferInline[N];
+    T* data;            // bufferInline atau buffer heap
+    int jumlah;
+    int kapasitas;
+    
+    bool pakaiInline() const {
+        return data == reinterpret_cast<const T*>(bufferInline);
+    }
+    
+    T* awalInline() {
+        return reinterpret_cast<T*>(bufferInline);
+    }
+    
+    // Helper: Hancurkan semua elemen (buffer tidak dilepas)
+    void hancurkanSemua() {
+        for (int i = 0; i < jumlah; i++) {
+            data[i].~T();
+        }
+        jumlah = 0;
+    }
+    
+    // Helper: Lepas buffer heap, kembali ke buffer inline
+    void lepasBuffer() {
+        if (!pakaiInline()) {
+            ::operator delete(data);
+            data = awalInline();
+            kapasitas = N;
+        }
+    }
+    
+    // Helper: Pindahkan elemen ke buffer heap baru berkapasitas kapasitasBaru
+    void pindahBuffer(int kapasitasBaru) {
+        T* bufferBaru = static_cast<T*>(::operator new(sizeof(T) * kapasitasBaru));
+        
+        for (int i = 0; i < jumlah; i++) {
+            new (&bufferBaru[i]) T(std::move(data[i]));
+            data[i].~T();
+        }
+        
+        if (!pakaiInline()) {
+            ::operator delete(data);
+        }
+        data = bufferBaru;
+        kapasitas = kapasitasBaru;
+    }
+    
+    // Helper: Ambil alih isi array lain (this harus kosong & inline)
+    void ambilDari(ArrayKecil& other) {
+        if (other.pakaiInline()) {
+            for (int i = 0; i < other.jumlah; i++) {
+                new (&data[i]) T(std::move(other.data[i]));
+            }
+            jumlah = other.jumlah;
+            other.hancurkanSemua();
+        } else {
+            // Buffer heap cukup dipindah pointernya
+            data = other.data;
+            jumlah = other.jumlah;
+            kapasitas = other.kapasitas;
+            
+            other.data = other.awalInline();
+            other.jumlah = 0;
+            other.kapasitas = N;
+        }
+    }
+
+public:
+    // Constructor
+    ArrayKecil() : data(awalInline()), jumlah(0), kapasitas(N) {}
+    
+    // Destructor
+    ~ArrayKecil() {
+        hancurkanSemua();
+        lepasBuffer();
+    }
+    
+    // Copy constructor (deep copy)
+    // Jika copy elemen melempar, elemen yang sudah jadi dihancurkan dan buffer
+    // heap dilepas (destructor tidak jalan untuk objek yang gagal dibangun)
+    ArrayKecil(const ArrayKecil& other) : data(awalInline()), jumlah(0), kapasitas(N) {
+        reservasi(other.jumlah);
+        try {
+            for (int i = 0; i < other.jumlah; i++) {
+                new (&data[i]) T(other.data[i]);
+                jumlah++;
+            }
+        } catch (...) {
+            hancurkanSemua();
+            lepasBuffer();
+            throw;
+        }
+    }
+    
+    ArrayKecil& operator=(const ArrayKecil& other) {
+        if (this != &other) {
+            ArrayKecil salinan(other);
+            *this = std::move(salinan);
+        }
+        return *this;
+    }
+    
+    // Move constructor
+    ArrayKecil(ArrayKecil&& other) : data(awalInline()), jumlah(0), kapasitas(N) {
+        ambilDari(other);
+    }
+    
+    ArrayKecil& operator=(ArrayKecil&& other) {
+        if (this != &other) {
+            hancurkanSemua();
+            lepasBuffer();
+            ambilDari(other);
+        }
+        return *this;
+    }
+    
+    // Cek apakah array kosong
+    bool kosong() const {
+        return jumlah == 0;
+    }
+    
+    // Dapatkan jumlah elemen
+    int ukuran() const {
+        return jumlah;
+    }
+    
+    // Cek apakah elemen masih di buffer inline (untuk benchmark / debugging)
+    bool isInline() const {
+        return pakaiInline();
+    }
+    
+    // Siapkan kapasitas untuk n elemen (satu kali pindah buffer)
+    void reservasi(int n) {
+        if (n <= kapasitas) return;
+        
+        int kapasitasBaru = kapasitas * 2;
+        while (kapasitasBaru < n) {
+            kapasitasBaru *= 2;
+        }
+        pindahBuffer(kapasitasBaru);
+    }
+    
+    // Tambah elemen di akhir (dibangun langsung di buffer)
+    template<typename... Args>
+    T& tambahBaru(Args&&... args) {
+        if (jumlah >= kapasitas) {
+            reservasi(jumlah + 1);
+        }
+        
+        T* elemen = new (&data[jumlah]) T(std::forward<Args>(args)...);
+        jumlah++;
+        return *elemen;
+    }
+    
+    void tambah(const T& nilai) {
+        tambahBaru(nilai);
+    }
+    
+    void tambah(T&& nilai) {
+        tambahBaru(std::move(nilai));
+    }
+    
+    // Hapus elemen by index (elemen sesudahnya digeser ke kiri)
+    bool hapus(int index) {
+        if (index < 0 || index >= jumlah) {
+            return false;
+        }
+        
+        for (int i = index; i < jumlah - 1; i++) {
+            data[i] = std::move(data[i + 1]);
+        }
+        
+        data[jumlah - 1].~T();
+        jumlah--;
+        return true;
+    }
+    
+    // Hapus semua elemen (buffer heap tetap dipakai ulang)
+    void clear() {
+        hancurkanSemua();
+    }
+    
+    // Akses elemen (index tidak dicek)
+    T& operator[](int index) { return data[index]; }
+    const T& operator[](int index) const { return data[index]; }
+    
+    // Dapatkan elemen by index, nullptr jika di luar jangkauan
+    T* dapatkan(int index) {
+        return (index >= 0 && index < jumlah) ? &data[index] : nullptr;
+    }
+    
+    const T* dapatkan(int index) const {
+        return (index >= 0 && index < jumlah) ? &data[index] : nullptr;
+    }
+    
+    // Iterasi semua elemen sesuai urutan
+    template<typename Function>
+    void iterasi(Function func) {
+        for (int i = 0; i < jumlah; i++) {
+            func(data[i]);
+        }
+    }
+    
+    template<typename Function>
+    void iterasi(Function func) const {
+        for (int i = 0; i < jumlah; i++) {
+            func(data[i]);
+        }
+    }
+};
+
+#endif
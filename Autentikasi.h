@@ -3,8 +3,11 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "CircularLinkedList.h"
+#include "TabelHash.h"
 #include "PengelolaFile.h"
+#include "SnapshotBiner.h"
 #include "Pengguna.h"
 using namespace std;
 
@@ -12,28 +15,74 @@ using namespace std;
 // SISTEM AUTENTIKASI - LOGIN & REGISTER
 // ============================================================================
 // Mengelola: Login, Register, Session management
+// Index hash (ID, email, nama lowercase) untuk pencarian pengguna O(1)
 // ============================================================================
 
 class SistemAutentikasi {
 private:
     CircularLinkedList<Pengguna*> daftarPengguna;
+    TabelHash<Pengguna*> indexId;     // Index by ID
+    TabelHash<Pengguna*> indexEmail;  // Index by email
+    TabelHash<Pengguna*> indexNama;   // Index by nama (lowercase), kembar: yang terakhir
     Pengguna* penggunaAktif;
     string namaFilePengguna;
     int counterIdPelanggan;
     int counterIdPegawai;
     
-    // Helper: Cari pengguna by username
-    Pengguna* cariPenggunaByUsername(const string& username) {
-        Pengguna* hasil = nullptr;
-        
-        daftarPengguna.iterasi([&](Pengguna* p) {
-            if (p->getId() == username || 
-                PengelolaFile::toLower(p->getNama()) == PengelolaFile::toLower(username)) {
-                hasil = p;
+    // Helper: Tambah pengguna ke list & semua index
+    void tambahPengguna(Pengguna* p) {
+        daftarPengguna.tambah(p);
+        indexId.insert(p, p->getId());
+        indexEmail.insert(p, p->getEmail());
+        indexNama.insert(p, PengelolaFile::toLower(p->getNama()));
+    }
+    
+    // Helper: Track max ID untuk auto-increment (P001 / PG001)
+    void catatIdPengguna(const PotonganString& id, RolePengguna role) {
+        int num;
+        if (role == RolePengguna::PELANGGAN) {
+            if (id.mulaiDengan("P") && PengelolaFile::parseInt(id.dari(1), num)) {
+                if (num >= counterIdPelanggan) counterIdPelanggan = num + 1;
+            }
+        } else if (role == RolePengguna::PEGAWAI) {
+            if (id.mulaiDengan("PG") && PengelolaFile::parseInt(id.dari(2), num)) {
+                if (num >= counterIdPegawai) counterIdPegawai = num + 1;
             }
+        }
+    }
+    
+    // Helper: Hapus key dari index hanya jika key itu milik pengguna ini
+    static void hapusDariIndex(TabelHash<Pengguna*>& index, const string& key, Pengguna* p) {
+        Pengguna** found = index.search(key);
+        if (found != nullptr && *found == p) {
+            index.hapus(key);
+        }
+    }
+    
+    // Helper: Arahkan key nama ke pengguna terakhir (urutan list) yang bernama
+    // sama, seperti pencarian linear lama. Dipanggil saat nama berubah agar
+    // pengguna lain dengan nama kembar tetap bisa ditemukan - O(n), jarang
+    void perbaruiIndexNama(const string& namaLower) {
+        Pengguna* terakhir = nullptr;
+        daftarPengguna.iterasi([&](Pengguna* p) {
+            if (PengelolaFile::toLower(p->getNama()) == namaLower) terakhir = p;
         });
         
-        return hasil;
+        if (terakhir != nullptr) {
+            indexNama.insert(terakhir, namaLower);
+        } else {
+            indexNama.hapus(namaLower);
+        }
+    }
+    
+    // Helper: Cari pengguna by username (ID atau nama)
+    Pengguna* cariPenggunaByUsername(const string& username) {
+        Pengguna** found = indexId.search(username);
+        if (found == nullptr) {
+            found = indexNama.search(PengelolaFile::toLower(username));
+        }
+        
+        return (found != nullptr) ? *found : nullptr;
     }
     
     // Helper: Validasi password strength
@@ -79,96 +128,161 @@ public:
     
     // Load data pengguna dari file
     bool muatDataPengguna() {
-        string baris[1000];
-        int jumlah = PengelolaFile::bacaSemuaBaris(namaFilePengguna, baris, 1000);
-        
-        if (jumlah == 0) {
-            cout << "[INFO] File pengguna kosong. Membuat akun pemilik default..." << endl;
-            buatAkunPemilikDefault();
-            return true;
-        }
-        
-        int maxIdPelanggan = 0;
-        int maxIdPegawai = 0;
-        
-        for (int i = 0; i < jumlah; i++) {
-            string fields[15];
+        int jumlah = PengelolaFile::bacaPerBaris(namaFilePengguna, [&](const string& baris) {
+            PotonganString fields[15];
             int fieldCount;
-            PengelolaFile::split(baris[i], '|', fields, fieldCount);
+            PengelolaFile::splitPotongan(baris, '|', fields, 15, fieldCount);
             
-            if (fieldCount < 7) continue;
+            if (fieldCount < 7) return;
             
-            string role = fields[0];
-            string id = fields[1];
-            string nama = fields[2];
-            string email = fields[3];
-            string telp = fields[4];
-            string password = fields[5];
+            PotonganString role = fields[0];
+            string id = fields[1].toString();
+            string nama = fields[2].toString();
+            string email = fields[3].toString();
+            string telp = fields[4].toString();
+            string password = fields[5].toString();
             bool aktif = (fields[6] == "1");
             
             Pengguna* pengguna = nullptr;
             
             if (role == "PELANGGAN" && fieldCount >= 10) {
-                string alamat = fields[7];
-                int totalTransaksi = (fieldCount > 8) ? stoi(fields[8]) : 0;
-                long long totalBelanja = (fieldCount > 9) ? stoll(fields[9]) : 0;
+                string alamat = fields[7].toString();
+                int totalTransaksi = 0;
+                long long totalBelanja = 0;
+                PengelolaFile::parseInt(fields[8], totalTransaksi);
+                PengelolaFile::parseLongLong(fields[9], totalBelanja);
                 
-                Pelanggan* p = new Pelanggan(id, nama, email, telp, password, alamat);
+                Pelanggan* p = new Pelanggan(std::move(id), std::move(nama), std::move(email),
+                                             std::move(telp), std::move(password), std::move(alamat));
                 p->setAktif(aktif);
                 // Set stats (tidak ada setter publik, jadi skip untuk sekarang)
                 pengguna = p;
                 
-                // Track max ID
-                if (id[0] == 'P' && id.length() > 1) {
-                    int num = stoi(id.substr(1));
-                    if (num > maxIdPelanggan) maxIdPelanggan = num;
-                }
-                
             } else if (role == "PEGAWAI" && fieldCount >= 11) {
-                string posisi = fields[7];
-                string shift = fields[8];
-                long long gaji = (fieldCount > 9) ? stoll(fields[9]) : 5000000;
+                string posisi = fields[7].toString();
+                string shift = fields[8].toString();
+                long long gaji = 5000000;
+                PengelolaFile::parseLongLong(fields[9], gaji);
                 
-                Pegawai* p = new Pegawai(id, nama, email, telp, password, posisi, shift, gaji);
+                Pegawai* p = new Pegawai(std::move(id), std::move(nama), std::move(email),
+                                         std::move(telp), std::move(password),
+                                         std::move(posisi), std::move(shift), gaji);
                 p->setAktif(aktif);
                 pengguna = p;
                 
-                // Track max ID
-                if (id.substr(0, 2) == "PG" && id.length() > 2) {
-                    int num = stoi(id.substr(2));
-                    if (num > maxIdPegawai) maxIdPegawai = num;
-                }
-                
             } else if (role == "PEMILIK") {
-                pengguna = new Pemilik(id, nama, email, telp, password);
+                pengguna = new Pemilik(std::move(id), std::move(nama), std::move(email),
+                                       std::move(telp), std::move(password));
                 pengguna->setAktif(aktif);
             }
             
             if (pengguna != nullptr) {
-                daftarPengguna.tambah(pengguna);
+                tambahPengguna(pengguna);
+                catatIdPengguna(fields[1], pengguna->getRole());
             }
-        }
+        });
         
-        // Update counter
-        counterIdPelanggan = maxIdPelanggan + 1;
-        counterIdPegawai = maxIdPegawai + 1;
+        if (jumlah == 0) {
+            PengelolaFile::cetakBaris("[INFO] File pengguna kosong. Membuat akun pemilik default...");
+            buatAkunPemilikDefault();
+            return true;
+        }
         
-        cout << "[SUKSES] Berhasil memuat " << daftarPengguna.ukuran() << " pengguna" << endl;
+        PengelolaFile::cetakBaris("[SUKSES] Berhasil memuat " + to_string(daftarPengguna.ukuran()) + " pengguna");
         return true;
     }
     
-    // Simpan semua data pengguna ke file
-    bool simpanDataPengguna() {
-        string baris[1000];
-        int jumlah = 0;
+    // Byte per record pengguna di snapshot biner
+    static const size_t LEBAR_RECORD_SNAPSHOT = 2 * sizeof(uint8_t) + 7 * sizeof(uint32_t) + sizeof(int64_t);
+    
+    // Tulis semua pengguna ke snapshot biner
+    // Record: role, aktif, id, nama, email, telp, password, teks1, teks2, angka
+    // Pelanggan: teks1 = alamat | Pegawai: teks1 = posisi, teks2 = shift, angka = gaji
+    void tulisSnapshot(PenulisSnapshot& snapshot) const {
+        snapshot.setJumlahData(BagianSnapshot::PENGGUNA, daftarPengguna.ukuran());
         
         daftarPengguna.iterasi([&](Pengguna* p) {
-            if (jumlah < 1000) {
-                baris[jumlah++] = p->toFileFormat();
+            string teks1, teks2;
+            long long angka = 0;
+            
+            if (p->getRole() == RolePengguna::PELANGGAN) {
+                teks1 = static_cast<Pelanggan*>(p)->getAlamat();
+            } else if (p->getRole() == RolePengguna::PEGAWAI) {
+                Pegawai* pegawai = static_cast<Pegawai*>(p);
+                teks1 = pegawai->getPosisi();
+                teks2 = pegawai->getShift();
+                angka = static_cast<long long>(pegawai->getGaji());
             }
+            
+            snapshot.tulis<uint8_t>(static_cast<uint8_t>(p->getRole()));
+            snapshot.tulis<uint8_t>(p->isAktif() ? 1 : 0);
+            snapshot.tulisString(p->getId());
+            snapshot.tulisString(p->getNama());
+            snapshot.tulisString(p->getEmail());
+            snapshot.tulisString(p->getNomorTelepon());
+            snapshot.tulisString(p->getPassword());
+            snapshot.tulisString(teks1);
+            snapshot.tulisString(teks2);
+            snapshot.tulis<int64_t>(angka);
         });
+    }
+    
+    // Load pengguna dari snapshot biner (sudah divalidasi oleh PembacaSnapshot)
+    bool muatSnapshot(PembacaSnapshot& snapshot) {
+        uint32_t jumlah = snapshot.getJumlahData(BagianSnapshot::PENGGUNA);
+        
+        indexId.reservasi(jumlah);
+        indexEmail.reservasi(jumlah);
+        indexNama.reservasi(jumlah);
+        
+        for (uint32_t i = 0; i < jumlah; i++) {
+            RolePengguna role = static_cast<RolePengguna>(snapshot.baca<uint8_t>());
+            bool aktif = snapshot.baca<uint8_t>() != 0;
+            const string& id = snapshot.bacaString();
+            const string& nama = snapshot.bacaString();
+            const string& email = snapshot.bacaString();
+            const string& telp = snapshot.bacaString();
+            const string& password = snapshot.bacaString();
+            const string& teks1 = snapshot.bacaString();
+            const string& teks2 = snapshot.bacaString();
+            long long angka = snapshot.baca<int64_t>();
+            
+            Pengguna* pengguna = nullptr;
+            
+            switch (role) {
+                case RolePengguna::PELANGGAN:
+                    pengguna = new Pelanggan(id, nama, email, telp, password, teks1);
+                    break;
+                case RolePengguna::PEGAWAI:
+                    pengguna = new Pegawai(id, nama, email, telp, password, teks1, teks2, angka);
+                    break;
+                case RolePengguna::PEMILIK:
+                    pengguna = new Pemilik(id, nama, email, telp, password);
+                    break;
+            }
+            
+            if (pengguna != nullptr) {
+                pengguna->setAktif(aktif);
+                tambahPengguna(pengguna);
+                catatIdPengguna(PotonganString(id), role);
+            }
+        }
+        
+        if (jumlah == 0) {
+            buatAkunPemilikDefault();
+        }
         
-        return PengelolaFile::tulisSemuaBaris(namaFilePengguna, baris, jumlah);
+        PengelolaFile::cetakBaris("[SUKSES] Berhasil memuat " + to_string(daftarPengguna.ukuran()) + " pengguna");
+        return !snapshot.gagal();
+    }
+    
+    // Simpan semua data pengguna ke file
+    bool simpanDataPengguna() {
+        return PengelolaFile::tulisPerBaris(namaFilePengguna, [&](PenulisFile& penulis) {
+            daftarPengguna.iterasi([&](Pengguna* p) {
+                penulis.tulisBaris(p->toFileFormat());
+            });
+        });
     }
     
     // Buat akun pemilik default jika belum ada
@@ -176,16 +290,18 @@ public:
         Pemilik* owner = new Pemilik("OWNER", "Administrator", 
                                      "admin@hotelparadise.com", 
                                      "081234567890", "admin123");
-        daftarPengguna.tambah(owner);
+        tambahPengguna(owner);
         simpanDataPengguna();
         
-        cout << "\n+------------------------------------------------------------+" << endl;
-        cout << "          AKUN PEMILIK DEFAULT TELAH DIBUAT                 " << endl;
-        cout << "------------------------------------------------------------" << endl;
-        cout << "  Username : OWNER                                          " << endl;
-        cout << "  Password : admin123                                       " << endl;
-        cout << "  Role     : Pemilik (Full Access)                          " << endl;
-        cout << "+------------------------------------------------------------+" << endl;
+        // Dicetak sekaligus agar tidak tersela pesan load data lain
+        PengelolaFile::cetakBaris(
+            "\n+------------------------------------------------------------+\n"
+            "          AKUN PEMILIK DEFAULT TELAH DIBUAT                 \n"
+            "------------------------------------------------------------\n"
+            "  Username : OWNER                                          \n"
+            "  Password : admin123                                       \n"
+            "  Role     : Pemilik (Full Access)                          \n"
+            "+------------------------------------------------------------+");
     }
     
     // Register pelanggan baru
@@ -211,14 +327,7 @@ public:
         }
         
         // Cek email sudah terdaftar
-        bool emailSudahAda = false;
-        daftarPengguna.iterasi([&](Pengguna* p) {
-            if (p->getEmail() == email) {
-                emailSudahAda = true;
-            }
-        });
-        
-        if (emailSudahAda) {
+        if (indexEmail.search(email) != nullptr) {
             cout << "[ERROR] Email sudah terdaftar!" << endl;
             return false;
         }
@@ -228,7 +337,7 @@ public:
         
         // Buat pelanggan baru
         Pelanggan* pelangganBaru = new Pelanggan(id, nama, email, telp, password, alamat);
-        daftarPengguna.tambah(pelangganBaru);
+        tambahPengguna(pelangganBaru);
         
         // Simpan ke file
         simpanDataPengguna();
@@ -247,14 +356,11 @@ public:
     
     // Login
     bool login(const string& emailOrId, const string& password) {
-        Pengguna* pengguna = nullptr;
-        
         // Cari by email atau ID
-        daftarPengguna.iterasi([&](Pengguna* p) {
-            if (p->getEmail() == emailOrId || p->getId() == emailOrId) {
-                pengguna = p;
-            }
-        });
+        Pengguna* pengguna = cariPenggunaByEmail(emailOrId);
+        if (pengguna == nullptr) {
+            pengguna = cariPenggunaById(emailOrId);
+        }
         
         if (pengguna == nullptr) {
             cout << "[ERROR] Email/ID tidak ditemukan!" << endl;
@@ -324,12 +430,7 @@ public:
         }
         
         // Cek email sudah ada
-        bool emailAda = false;
-        daftarPengguna.iterasi([&](Pengguna* p) {
-            if (p->getEmail() == email) emailAda = true;
-        });
-        
-        if (emailAda) {
+        if (indexEmail.search(email) != nullptr) {
             cout << "[ERROR] Email sudah terdaftar!" << endl;
             return false;
         }
@@ -339,7 +440,7 @@ public:
         
         Pegawai* pegawaiBaru = new Pegawai(id, nama, email, telp, password,
                                            posisi, shift, gaji);
-        daftarPengguna.tambah(pegawaiBaru);
+        tambahPengguna(pegawaiBaru);
         simpanDataPengguna();
         
         cout << "[SUKSES] Pegawai berhasil ditambahkan dengan ID: " << id << endl;
@@ -371,11 +472,7 @@ public:
     
     // Nonaktifkan pengguna (untuk owner)
     bool nonaktifkanPengguna(const string& id) {
-        Pengguna* target = nullptr;
-        
-        daftarPengguna.iterasi([&](Pengguna* p) {
-            if (p->getId() == id) target = p;
-        });
+        Pengguna* target = cariPenggunaById(id);
         
         if (target == nullptr) {
             cout << "[ERROR] Pengguna dengan ID " << id << " tidak ditemukan!" << endl;
@@ -391,11 +488,7 @@ public:
     
     // Aktifkan kembali pengguna
     bool aktifkanPengguna(const string& id) {
-        Pengguna* target = nullptr;
-        
-        daftarPengguna.iterasi([&](Pengguna* p) {
-            if (p->getId() == id) target = p;
-        });
+        Pengguna* target = cariPenggunaById(id);
         
         if (target == nullptr) {
             cout << "[ERROR] Pengguna dengan ID " << id << " tidak ditemukan!" << endl;
@@ -409,6 +502,33 @@ public:
         return true;
     }
     
+    // Cari pengguna by ID - O(1)
+    Pengguna* cariPenggunaById(const string& id) {
+        Pengguna** found = indexId.search(id);
+        return (found != nullptr) ? *found : nullptr;
+    }
+    
+    // Cari pengguna by email - O(1)
+    Pengguna* cariPenggunaByEmail(const string& email) {
+        Pengguna** found = indexEmail.search(email);
+        return (found != nullptr) ? *found : nullptr;
+    }
+    
+    // Ubah nama pengguna (index nama ikut diperbarui)
+    void ubahNamaPengguna(Pengguna* user, const string& namaBaru) {
+        string namaLama = PengelolaFile::toLower(user->getNama());
+        user->setNama(namaBaru);
+        perbaruiIndexNama(namaLama);
+        perbaruiIndexNama(PengelolaFile::toLower(namaBaru));
+    }
+    
+    // Ubah email pengguna (index email ikut diperbarui)
+    void ubahEmailPengguna(Pengguna* user, const string& emailBaru) {
+        hapusDariIndex(indexEmail, user->getEmail(), user);
+        user->setEmail(emailBaru);
+        indexEmail.insert(user, emailBaru);
+    }
+    
     // Get daftar pengguna (untuk keperluan lain)
     CircularLinkedList<Pengguna*>& getDaftarPengguna() {
         return daftarPengguna;
@@ -3,6 +3,9 @@
 
 #include <iostream>
 #include <string>
+#include <algorithm>
+#include "AlokatorNode.h"
+#include "Stack.h"
 using namespace std;
 
 // ============================================================================
@@ -10,149 +13,261 @@ using namespace std;
 // ============================================================================
 // Digunakan untuk pencarian cepat: O(log n) average case
 // Contoh penggunaan: Cari kamar by nomor, cari user by ID
+// Mode AVL menjaga tree tetap seimbang (O(log n) worst case), cocok untuk
+// key yang masuk sudah terurut seperti nomor kamar K101..K502
+// Search & traversal iteratif (tidak ada rekursi sedalam tinggi tree)
 // ============================================================================
 
+// Enum untuk mode penyeimbangan tree
+enum class ModeBST {
+    BIASA,  // BST biasa, bisa degenerasi jadi linked list
+    AVL     // Self-balancing (AVL)
+};
+
 template<typename T, typename KeyType>
 struct BSTNode {
     T data;
     KeyType key;
     BSTNode<T, KeyType>* left;
     BSTNode<T, KeyType>* right;
+    int tinggi; // Tinggi subtree (dipakai mode AVL)
     
-    BSTNode(const T& nilai, const KeyType& kunci) 
-        : data(nilai), key(kunci), left(nullptr), right(nullptr) {}
+    BSTNode(const T& nilai, const KeyType& kunci)
+        : data(nilai), key(kunci), left(nullptr), right(nullptr), tinggi(1) {}
 };
 
-template<typename T, typename KeyType>
+template<typename T, typename KeyType,
+         typename Alokator = AlokatorPool<BSTNode<T, KeyType> > >
 class BinarySearchTree {
 private:
     BSTNode<T, KeyType>* root;
     int jumlahNode;
+    ModeBST mode;
+    Alokator alokator;
     
-    // Helper function untuk insert rekursif
-    BSTNode<T, KeyType>* insertRekursif(BSTNode<T, KeyType>* node, 
-                                         const T& data, const KeyType& key) {
-        // Base case: tempat kosong ditemukan
-        if (node == nullptr) {
-            jumlahNode++;
-            return new BSTNode<T, KeyType>(data, key);
-        }
+    // Helper: Cari node berdasarkan key (iteratif)
+    BSTNode<T, KeyType>* cariNode(const KeyType& key) const {
+        BSTNode<T, KeyType>* node = root;
         
-        // Rekursif ke kiri atau kanan
-        if (key < node->key) {
-            node->left = insertRekursif(node->left, data, key);
-        } else if (key > node->key) {
-            node->right = insertRekursif(node->right, data, key);
-        } else {
-            // Key sudah ada, update data
-            node->data = data;
+        while (node != nullptr && !(node->key == key)) {
+            if (key < node->key) {
+                node = node->left;
+            } else {
+                node = node->right;
+            }
         }
         
         return node;
     }
     
-    // Helper function untuk search rekursif
-    BSTNode<T, KeyType>* searchRekursif(BSTNode<T, KeyType>* node, 
-                                         const KeyType& key) const {
-        // Base case: tidak ditemukan atau ditemukan
-        if (node == nullptr || node->key == key) {
-            return node;
+    // Helper function untuk cari node minimum
+    BSTNode<T, KeyType>* findMin(BSTNode<T, KeyType>* node) const {
+        while (node->left != nullptr) {
+            node = node->left;
         }
+        return node;
+    }
+    
+    // ========================================================================
+    // MODE BIASA - insert & delete iteratif
+    // ========================================================================
+    
+    void insertIteratif(const T& data, const KeyType& key) {
+        BSTNode<T, KeyType>** posisi = &root;
         
-        // Rekursif ke kiri atau kanan
-        if (key < node->key) {
-            return searchRekursif(node->left, key);
-        } else {
-            return searchRekursif(node->right, key);
+        while (*posisi != nullptr) {
+            if (key < (*posisi)->key) {
+                posisi = &(*posisi)->left;
+            } else if (key > (*posisi)->key) {
+                posisi = &(*posisi)->right;
+            } else {
+                // Key sudah ada, update data
+                (*posisi)->data = data;
+                return;
+            }
         }
+        
+        *posisi = alokator.alokasi(data, key);
+        jumlahNode++;
     }
     
-    // Helper function untuk cari node minimum
-    BSTNode<T, KeyType>* findMin(BSTNode<T, KeyType>* node) const {
-        while (node->left != nullptr) {
-            node = node->left;
+    bool deleteIteratif(const KeyType& key) {
+        BSTNode<T, KeyType>** posisi = &root;
+        
+        while (*posisi != nullptr && !((*posisi)->key == key)) {
+            if (key < (*posisi)->key) {
+                posisi = &(*posisi)->left;
+            } else {
+                posisi = &(*posisi)->right;
+            }
         }
+        
+        BSTNode<T, KeyType>* node = *posisi;
+        if (node == nullptr) return false;
+        
+        // Punya 2 anak: ganti dengan successor, lalu hapus successor
+        if (node->left != nullptr && node->right != nullptr) {
+            BSTNode<T, KeyType>** posisiSuccessor = &node->right;
+            while ((*posisiSuccessor)->left != nullptr) {
+                posisiSuccessor = &(*posisiSuccessor)->left;
+            }
+            
+            BSTNode<T, KeyType>* successor = *posisiSuccessor;
+            node->data = successor->data;
+            node->key = successor->key;
+            
+            posisi = posisiSuccessor;
+            node = successor;
+        }
+        
+        // Sisa kasus: leaf atau punya 1 anak
+        *posisi = (node->left != nullptr) ? node->left : node->right;
+        alokator.dealokasi(node);
+        jumlahNode--;
+        return true;
+    }
+    
+    // ========================================================================
+    // MODE AVL - rekursi dibatasi tinggi tree (~1.44 log n)
+    // ========================================================================
+    
+    static int tinggiNode(BSTNode<T, KeyType>* node) {
+        return (node == nullptr) ? 0 : node->tinggi;
+    }
+    
+    static void perbaruiTinggi(BSTNode<T, KeyType>* node) {
+        int kiri = tinggiNode(node->left);
+        int kanan = tinggiNode(node->right);
+        node->tinggi = 1 + (kiri > kanan ? kiri : kanan);
+    }
+    
+    static BSTNode<T, KeyType>* rotasiKanan(BSTNode<T, KeyType>* node) {
+        BSTNode<T, KeyType>* kiri = node->left;
+        node->left = kiri->right;
+        kiri->right = node;
+        perbaruiTinggi(node);
+        perbaruiTinggi(kiri);
+        return kiri;
+    }
+    
+    static BSTNode<T, KeyType>* rotasiKiri(BSTNode<T, KeyType>* node) {
+        BSTNode<T, KeyType>* kanan = node->right;
+        node->right = kanan->left;
+        kanan->left = node;
+        perbaruiTinggi(node);
+        perbaruiTinggi(kanan);
+        return kanan;
+    }
+    
+    // Helper: Seimbangkan node setelah insert/delete
+    static BSTNode<T, KeyType>* seimbangkan(BSTNode<T, KeyType>* node) {
+        perbaruiTinggi(node);
+        int faktor = tinggiNode(node->left) - tinggiNode(node->right);
+        
+        // Berat ke kiri
+        if (faktor > 1) {
+            if (tinggiNode(node->left->left) < tinggiNode(node->left->right)) {
+                node->left = rotasiKiri(node->left);
+            }
+            return rotasiKanan(node);
+        }
+        
+        // Berat ke kanan
+        if (faktor < -1) {
+            if (tinggiNode(node->right->right) < tinggiNode(node->right->left)) {
+                node->right = rotasiKanan(node->right);
+            }
+            return rotasiKiri(node);
+        }
+        
         return node;
     }
     
-    // Helper function untuk delete rekursif
-    BSTNode<T, KeyType>* deleteRekursif(BSTNode<T, KeyType>* node, 
-                                         const KeyType& key, bool& berhasil) {
+    BSTNode<T, KeyType>* insertAVL(BSTNode<T, KeyType>* node,
+                                   const T& data, const KeyType& key) {
+        if (node == nullptr) {
+            jumlahNode++;
+            return alokator.alokasi(data, key);
+        }
+        
+        if (key < node->key) {
+            node->left = insertAVL(node->left, data, key);
+        } else if (key > node->key) {
+            node->right = insertAVL(node->right, data, key);
+        } else {
+            // Key sudah ada, update data
+            node->data = data;
+            return node;
+        }
+        
+        return seimbangkan(node);
+    }
+    
+    BSTNode<T, KeyType>* deleteAVL(BSTNode<T, KeyType>* node,
+                                   const KeyType& key, bool& berhasil) {
         if (node == nullptr) {
-            berhasil = false;
             return nullptr;
         }
         
         if (key < node->key) {
-            node->left = deleteRekursif(node->left, key, berhasil);
-        } 
-        else if (key > node->key) {
-            node->right = deleteRekursif(node->right, key, berhasil);
-        } 
-        else {
-            // Node ditemukan, hapus!
+            node->left = deleteAVL(node->left, key, berhasil);
+        } else if (key > node->key) {
+            node->right = deleteAVL(node->right, key, berhasil);
+        } else {
             berhasil = true;
             
-            // Case 1: Leaf node (tidak punya anak)
-            if (node->left == nullptr && node->right == nullptr) {
-                delete node;
-                jumlahNode--;
-                return nullptr;
-            }
-            
-            // Case 2: Punya 1 anak (kiri)
-            if (node->right == nullptr) {
-                BSTNode<T, KeyType>* temp = node->left;
-                delete node;
-                jumlahNode--;
-                return temp;
-            }
-            
-            // Case 3: Punya 1 anak (kanan)
-            if (node->left == nullptr) {
-                BSTNode<T, KeyType>* temp = node->right;
-                delete node;
+            // Leaf atau punya 1 anak
+            if (node->left == nullptr || node->right == nullptr) {
+                BSTNode<T, KeyType>* anak = (node->left != nullptr) ? node->left : node->right;
+                alokator.dealokasi(node);
                 jumlahNode--;
-                return temp;
+                return anak;
             }
             
-            // Case 4: Punya 2 anak
-            // Cari successor (node terkecil di subtree kanan)
+            // Punya 2 anak: copy successor lalu hapus successor dari subtree kanan
             BSTNode<T, KeyType>* successor = findMin(node->right);
-            
-            // Copy data successor ke node ini
             node->data = successor->data;
             node->key = successor->key;
-            
-            // Hapus successor
-            node->right = deleteRekursif(node->right, successor->key, berhasil);
+            node->right = deleteAVL(node->right, successor->key, berhasil);
         }
         
-        return node;
+        return seimbangkan(node);
     }
     
-    // Helper untuk inorder traversal
-    template<typename Function>
-    void inorderRekursif(BSTNode<T, KeyType>* node, Function func) const {
-        if (node != nullptr) {
-            inorderRekursif(node->left, func);
-            func(node->data);
-            inorderRekursif(node->right, func);
+    // Helper: Bangun subtree seimbang dari urutan[kiri..kanan] (tengah jadi root)
+    BSTNode<T, KeyType>* bangunSeimbang(const T* data, const KeyType* kunci,
+                                        const int* urutan, int kiri, int kanan) {
+        if (kiri > kanan) {
+            return nullptr;
+        }
+        
+        int tengah = kiri + (kanan - kiri) / 2;
+        BSTNode<T, KeyType>* node = alokator.alokasi(data[urutan[tengah]], kunci[urutan[tengah]]);
+        try {
+            node->left = bangunSeimbang(data, kunci, urutan, kiri, tengah - 1);
+            node->right = bangunSeimbang(data, kunci, urutan, tengah + 1, kanan);
+        } catch (...) {
+            // Subtree yang sudah jadi dikembalikan ke alokator
+            hapusSubtree(node);
+            throw;
         }
+        perbaruiTinggi(node);
+        return node;
     }
     
-    // Helper untuk destroy tree
-    void destroyRekursif(BSTNode<T, KeyType>* node) {
-        if (node != nullptr) {
-            destroyRekursif(node->left);
-            destroyRekursif(node->right);
-            delete node;
-        }
+    // Helper: Kembalikan semua node subtree ke alokator (kedalaman O(log n),
+    // hanya dipakai untuk subtree seimbang hasil bangunSeimbang)
+    void hapusSubtree(BSTNode<T, KeyType>* node) {
+        if (node == nullptr) return;
+        hapusSubtree(node->left);
+        hapusSubtree(node->right);
+        alokator.dealokasi(node);
     }
 
 public:
     // Constructor
-    BinarySearchTree() : root(nullptr), jumlahNode(0) {}
+    BinarySearchTree(ModeBST _mode = ModeBST::BIASA)
+        : root(nullptr), jumlahNode(0), mode(_mode) {}
     
     // Destructor
     ~BinarySearchTree() {
@@ -169,14 +284,23 @@ public:
         return jumlahNode;
     }
     
+    // Dapatkan mode tree
+    ModeBST getMode() const {
+        return mode;
+    }
+    
     // Insert data dengan key
     void insert(const T& data, const KeyType& key) {
-        root = insertRekursif(root, data, key);
+        if (mode == ModeBST::AVL) {
+            root = insertAVL(root, data, key);
+        } else {
+            insertIteratif(data, key);
+        }
     }
     
     // Search data berdasarkan key
     T* search(const KeyType& key) {
-        BSTNode<T, KeyType>* node = searchRekursif(root, key);
+        BSTNode<T, KeyType>* node = cariNode(key);
         
         if (node != nullptr) {
             return &(node->data);
@@ -187,7 +311,7 @@ public:
     
     // Search const version
     const T* search(const KeyType& key) const {
-        BSTNode<T, KeyType>* node = searchRekursif(root, key);
+        BSTNode<T, KeyType>* node = cariNode(key);
         
         if (node != nullptr) {
             return &(node->data);
@@ -198,22 +322,124 @@ public:
     
     // Hapus data berdasarkan key
     bool hapus(const KeyType& key) {
-        bool berhasil = false;
-        root = deleteRekursif(root, key, berhasil);
-        return berhasil;
+        if (mode == ModeBST::AVL) {
+            bool berhasil = false;
+            root = deleteAVL(root, key, berhasil);
+            return berhasil;
+        }
+        
+        return deleteIteratif(key);
     }
     
     // Clear semua data
+    // Iteratif: rotasi kanan sampai root tidak punya anak kiri, lalu hapus root
     void clear() {
-        destroyRekursif(root);
-        root = nullptr;
+        while (root != nullptr) {
+            if (root->left != nullptr) {
+                BSTNode<T, KeyType>* kiri = root->left;
+                root->left = kiri->right;
+                kiri->right = root;
+                root = kiri;
+            } else {
+                BSTNode<T, KeyType>* temp = root;
+                root = root->right;
+                alokator.dealokasi(temp);
+            }
+        }
+        
         jumlahNode = 0;
     }
     
-    // Inorder traversal (terurut ascending)
+    // Bangun ulang tree dari array data & key sekaligus (isi lama dihapus)
+    // O(n) jika key sudah terurut, selain itu diurutkan sekali O(n log n)
+    // Hasilnya tree seimbang sempurna; key duplikat: data terakhir yang dipakai
+    void bangunDariTerurut(const T* data, const KeyType* kunci, int n) {
+        clear();
+        if (n <= 0) return;
+        
+        // Urutkan index saja, data & key tidak dipindah
+        int* urutan = new int[n];
+        bool terurut = true;
+        for (int i = 0; i < n; i++) {
+            urutan[i] = i;
+            if (i > 0 && kunci[i] < kunci[i - 1]) {
+                terurut = false;
+            }
+        }
+        
+        if (!terurut) {
+            stable_sort(urutan, urutan + n, [kunci](int a, int b) {
+                return kunci[a] < kunci[b];
+            });
+        }
+        
+        // Buang key duplikat (yang terakhir menang, sama seperti insert)
+        int jumlahUnik = 0;
+        for (int i = 0; i < n; i++) {
+            if (jumlahUnik > 0 && kunci[urutan[jumlahUnik - 1]] == kunci[urutan[i]]) {
+                urutan[jumlahUnik - 1] = urutan[i];
+            } else {
+                urutan[jumlahUnik++] = urutan[i];
+            }
+        }
+        
+        // Alokasi node bisa melempar (bad_alloc / copy key), buffer tetap dibebaskan
+        try {
+            root = bangunSeimbang(data, kunci, urutan, 0, jumlahUnik - 1);
+        } catch (...) {
+            delete[] urutan;
+            throw;
+        }
+        jumlahNode = jumlahUnik;
+        
+        delete[] urutan;
+    }
+    
+    // Inorder traversal (terurut ascending), iteratif dengan Stack
     template<typename Function>
     void inorder(Function func) const {
-        inorderRekursif(root, func);
+        Stack<BSTNode<T, KeyType>*> tumpukan(jumlahNode + 1);
+        BSTNode<T, KeyType>* current = root;
+        
+        while (current != nullptr || !tumpukan.kosong()) {
+            while (current != nullptr) {
+                tumpukan.push(current);
+                current = current->left;
+            }
+            
+            tumpukan.pop(current);
+            func(current->data);
+            current = current->right;
+        }
+    }
+    
+    // Kedalaman maksimum tree (jumlah level), untuk cek keseimbangan
+    int kedalaman() const {
+        if (mode == ModeBST::AVL) {
+            return tinggiNode(root);
+        }
+        
+        // Mode biasa: tinggi tidak disimpan, hitung dengan DFS iteratif
+        struct NodeLevel {
+            BSTNode<T, KeyType>* node;
+            int level;
+        };
+        
+        Stack<NodeLevel> tumpukan(jumlahNode + 1);
+        int maksimal = 0;
+        
+        if (root != nullptr) {
+            tumpukan.push(NodeLevel{root, 1});
+        }
+        
+        NodeLevel item;
+        while (tumpukan.pop(item)) {
+            if (item.level > maksimal) maksimal = item.level;
+            if (item.node->left != nullptr) tumpukan.push(NodeLevel{item.node->left, item.level + 1});
+            if (item.node->right != nullptr) tumpukan.push(NodeLevel{item.node->right, item.level + 1});
+        }
+        
+        return maksimal;
     }
     
     // Tampilkan tree (inorder - terurut)
@@ -233,33 +459,31 @@ public:
         });
     }
     
-    // Cari data dalam range [keyMin, keyMax]
+    // Cari data dalam range [keyMin, keyMax], iteratif dengan Stack
     template<typename Function>
-    void searchRange(const KeyType& keyMin, const KeyType& keyMax, 
+    void searchRange(const KeyType& keyMin, const KeyType& keyMax,
                      Function func) const {
-        searchRangeRekursif(root, keyMin, keyMax, func);
-    }
-    
-private:
-    template<typename Function>
-    void searchRangeRekursif(BSTNode<T, KeyType>* node, 
-                             const KeyType& keyMin, const KeyType& keyMax,
-                             Function func) const {
-        if (node == nullptr) return;
+        Stack<BSTNode<T, KeyType>*> tumpukan(jumlahNode + 1);
+        BSTNode<T, KeyType>* current = root;
         
-        // Jika current key lebih besar dari min, cek left subtree
-        if (node->key > keyMin) {
-            searchRangeRekursif(node->left, keyMin, keyMax, func);
-        }
-        
-        // Jika current key dalam range, proses
-        if (node->key >= keyMin && node->key <= keyMax) {
-            func(node->data);
-        }
-        
-        // Jika current key lebih kecil dari max, cek right subtree
-        if (node->key < keyMax) {
-            searchRangeRekursif(node->right, keyMin, keyMax, func);
+        while (current != nullptr || !tumpukan.kosong()) {
+            while (current != nullptr) {
+                // Subtree kiri dari node < keyMin pasti di luar range
+                if (current->key < keyMin) {
+                    current = current->right;
+                } else {
+                    tumpukan.push(current);
+                    current = current->left;
+                }
+            }
+            
+            if (!tumpukan.pop(current)) break;
+            
+            // Semua node berikutnya lebih besar, berhenti
+            if (current->key > keyMax) break;
+            
+            func(current->data);
+            current = current->right;
         }
     }
 };
@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
+#include "AlokatorNode.h"
 using namespace std;
 
 // ============================================================================
@@ -10,6 +12,8 @@ using namespace std;
 // ============================================================================
 // Digunakan untuk menyimpan: Pengguna, Kamar, Layanan, Transaksi
 // Keunggulan: Akses melingkar, efisien untuk iterasi berulang
+// Pointer tail disimpan agar tambah di awal/akhir tetap O(1)
+// Node dialokasikan lewat Alokator (default: pool, lihat AlokatorNode.h)
 // ============================================================================
 
 template<typename T>
@@ -17,41 +21,66 @@ struct Node {
     T data;
     Node<T>* next;
     
-    Node(const T& nilai) : data(nilai), next(nullptr) {}
+    // Data dibangun langsung di node (copy, move, atau argumen constructor T)
+    template<typename... Args>
+    Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alokator = AlokatorPool<Node<T> > >
 class CircularLinkedList {
 private:
     Node<T>* head;
+    Node<T>* tail;  // Node terakhir (tail->next == head)
     int jumlahNode;
+    Alokator alokator;
 
 public:
     // Constructor
-    CircularLinkedList() : head(nullptr), jumlahNode(0) {}
+    CircularLinkedList() : head(nullptr), tail(nullptr), jumlahNode(0) {}
+    
+    // Copy constructor (deep copy, node baru dari alokator sendiri)
+    CircularLinkedList(const CircularLinkedList& other)
+        : head(nullptr), tail(nullptr), jumlahNode(0) {
+        other.iterasi([this](const T& data) {
+            tambah(data);
+        });
+    }
+    
+    // Copy assignment
+    CircularLinkedList& operator=(const CircularLinkedList& other) {
+        if (this != &other) {
+            clear();
+            other.iterasi([this](const T& data) {
+                tambah(data);
+            });
+        }
+        return *this;
+    }
     
     // Destructor - Mencegah memory leak
     ~CircularLinkedList() {
+        clear();
+    }
+    
+    // Hapus semua node (slot dikembalikan ke alokator)
+    void clear() {
         if (head == nullptr) return;
         
         Node<T>* current = head;
         Node<T>* temp;
         
         // Putus circular sebelum delete
-        Node<T>* tail = head;
-        while (tail->next != head) {
-            tail = tail->next;
-        }
         tail->next = nullptr;
         
         // Delete semua node
         while (current != nullptr) {
             temp = current;
             current = current->next;
-            delete temp;
+            alokator.dealokasi(temp);
         }
         
         head = nullptr;
+        tail = nullptr;
         jumlahNode = 0;
     }
     
@@ -67,41 +96,81 @@ public:
     
     // Tambah data di akhir list
     void tambah(const T& data) {
-        Node<T>* nodeBaru = new Node<T>(data);
+        tambahBaru(data);
+    }
+    
+    // Tambah data di akhir list (data di-move ke node, tanpa copy)
+    void tambah(T&& data) {
+        tambahBaru(std::move(data));
+    }
+    
+    // Bangun data baru langsung di node akhir list (emplace)
+    // Contoh: daftarNama.tambahBaru(5, 'x')  ->  node berisi string(5, 'x')
+    template<typename... Args>
+    void tambahBaru(Args&&... args) {
+        Node<T>* nodeBaru = alokator.alokasi(std::forward<Args>(args)...);
         
         if (head == nullptr) {
             // List kosong, buat circular ke diri sendiri
             head = nodeBaru;
             nodeBaru->next = head;
         } else {
-            // Cari node terakhir
-            Node<T>* tail = head;
-            while (tail->next != head) {
-                tail = tail->next;
-            }
-            
-            // Tambahkan di akhir
+            // Tambahkan setelah tail
             tail->next = nodeBaru;
             nodeBaru->next = head;
         }
         
+        tail = nodeBaru;
         jumlahNode++;
     }
     
+    // Tambah banyak data sekaligus di akhir list dari range [awal, akhir)
+    // Rantai node dibangun dulu, lalu disambung ke ring dalam satu langkah
+    // (jika alokasi gagal di tengah, rantai dilepas dan list tidak berubah)
+    // Contoh: tambahBanyak(array, array + jumlah)
+    template<typename Iterator>
+    void tambahBanyak(Iterator awal, Iterator akhir) {
+        if (awal == akhir) return;
+        
+        Node<T>* rantaiHead = alokator.alokasi(*awal);
+        Node<T>* rantaiTail = rantaiHead;
+        int jumlahBaru = 1;
+        
+        try {
+            for (++awal; awal != akhir; ++awal) {
+                rantaiTail->next = alokator.alokasi(*awal);
+                rantaiTail = rantaiTail->next;
+                jumlahBaru++;
+            }
+        } catch (...) {
+            while (rantaiHead != nullptr) {
+                Node<T>* berikutnya = rantaiHead->next;
+                alokator.dealokasi(rantaiHead);
+                rantaiHead = berikutnya;
+            }
+            throw;
+        }
+        
+        if (head == nullptr) {
+            head = rantaiHead;
+        } else {
+            tail->next = rantaiHead;
+        }
+        
+        rantaiTail->next = head;
+        tail = rantaiTail;
+        jumlahNode += jumlahBaru;
+    }
+    
     // Tambah data di awal list
     void tambahDiAwal(const T& data) {
-        Node<T>* nodeBaru = new Node<T>(data);
+        Node<T>* nodeBaru = alokator.alokasi(data);
         
         if (head == nullptr) {
             head = nodeBaru;
+            tail = nodeBaru;
             nodeBaru->next = head;
         } else {
-            // Cari tail
-            Node<T>* tail = head;
-            while (tail->next != head) {
-                tail = tail->next;
-            }
-            
             nodeBaru->next = head;
             tail->next = nodeBaru;
             head = nodeBaru;
@@ -119,19 +188,14 @@ public:
         Node<T>* current = head;
         Node<T>* previous = nullptr;
         
-        // Cari tail untuk handle circular
-        Node<T>* tail = head;
-        while (tail->next != head) {
-            tail = tail->next;
-        }
-        
         // Cari node yang memenuhi kondisi
         do {
             if (kondisi(current->data)) {
                 // Kasus 1: Hanya 1 node
                 if (current == head && current->next == head) {
-                    delete current;
+                    alokator.dealokasi(current);
                     head = nullptr;
+                    tail = nullptr;
                     jumlahNode--;
                     return true;
                 }
@@ -141,14 +205,17 @@ public:
                     tail->next = head->next;
                     Node<T>* temp = head;
                     head = head->next;
-                    delete temp;
+                    alokator.dealokasi(temp);
                     jumlahNode--;
                     return true;
                 }
                 
                 // Kasus 3: Hapus di tengah/akhir
                 previous->next = current->next;
-                delete current;
+                if (current == tail) {
+                    tail = previous;
+                }
+                alokator.dealokasi(current);
                 jumlahNode--;
                 return true;
             }
@@ -197,8 +264,8 @@ public:
     
     // Dapatkan semua data yang memenuhi kondisi
     template<typename Predicate>
-    CircularLinkedList<T> filter(Predicate kondisi) const {
-        CircularLinkedList<T> hasil;
+    CircularLinkedList<T, Alokator> filter(Predicate kondisi) const {
+        CircularLinkedList<T, Alokator> hasil;
         
         if (head == nullptr) return hasil;
         
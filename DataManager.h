@@ -3,17 +3,23 @@
 
 #include <iostream>
 #include <string>
+#include <thread>
 #include "Autentikasi.h"
 #include "ManajemenKamar.h"
 #include "ManajemenLayanan.h"
 #include "SistemPembayaran.h"
 #include "PengelolaFile.h"
+#include "SnapshotBiner.h"
 using namespace std;
 
 // ============================================================================
 // DATA MANAGER - CENTRAL DATA MANAGEMENT
 // ============================================================================
 // Mengelola: Load/save semua data, Inisialisasi data default 20+
+// Cold start: snapshot biner (data.snapshot) jika masih sesuai file teks,
+// selain itu parse file teks seperti biasa
+// Mode paralel: keempat file teks dibaca di thread terpisah, transaksi.txt
+// juga dibagi per potongan sesuai jumlah core
 // ============================================================================
 
 class DataManager {
@@ -22,21 +28,112 @@ private:
     ManajemenKamar* manajemenKamar;
     ManajemenLayanan* manajemenLayanan;
     SistemPembayaran* sistemPembayaran;
+    bool modeParalel;
+    
+    static const int JUMLAH_FILE_SUMBER = 7;
+    
+    // Helper: Nama file snapshot biner
+    static const string& fileSnapshot() {
+        static const string nama = "data.snapshot";
+        return nama;
+    }
+    
+    // Helper: File teks yang dicakup snapshot (snapshot basi jika salah satu berubah)
+    static const string* daftarFileSumber() {
+        static const string daftar[JUMLAH_FILE_SUMBER] = {
+            "pengguna.txt", "kamar.txt", "kamar.log", "layanan.txt",
+            "layanan.log", "transaksi.txt", "transaksi.log"
+        };
+        return daftar;
+    }
+    
+    // Helper: Load semua data dari snapshot biner, false jika tidak bisa dipakai
+    bool muatSnapshot(bool& kamarLoaded, bool& layananLoaded) {
+        const size_t lebarRecord[JUMLAH_BAGIAN_SNAPSHOT] = {
+            SistemAutentikasi::LEBAR_RECORD_SNAPSHOT,
+            ManajemenKamar::LEBAR_RECORD_SNAPSHOT,
+            ManajemenLayanan::LEBAR_RECORD_SNAPSHOT,
+            SistemPembayaran::LEBAR_RECORD_SNAPSHOT
+        };
+        
+        PembacaSnapshot snapshot;
+        if (!snapshot.buka(fileSnapshot(), daftarFileSumber(), JUMLAH_FILE_SUMBER, lebarRecord)) {
+            return false;
+        }
+        
+        // Urutan harus sama dengan simpanSnapshot()
+        autentikasi->muatSnapshot(snapshot);
+        kamarLoaded = manajemenKamar->muatSnapshot(snapshot);
+        layananLoaded = manajemenLayanan->muatSnapshot(snapshot);
+        sistemPembayaran->muatSnapshot(snapshot);
+        
+        return true;
+    }
+    
+    // Helper: Tulis snapshot biner dari data di memori
+    bool simpanSnapshot() {
+        PenulisSnapshot snapshot;
+        
+        autentikasi->tulisSnapshot(snapshot);
+        manajemenKamar->tulisSnapshot(snapshot);
+        manajemenLayanan->tulisSnapshot(snapshot);
+        sistemPembayaran->tulisSnapshot(snapshot);
+        
+        return snapshot.simpan(fileSnapshot(), daftarFileSumber(), JUMLAH_FILE_SUMBER);
+    }
+    
+    // Helper: Load semua file teks, satu thread per modul
+    // Setiap modul hanya menyentuh datanya sendiri, jadi aman dijalankan
+    // bersamaan. Transaksi (file terbesar) di thread ini dengan pembagian potongan
+    void muatFileTeksParalel(bool& kamarLoaded, bool& layananLoaded) {
+        unsigned int jumlahCore = thread::hardware_concurrency();
+        if (jumlahCore == 0) jumlahCore = 1;
+        
+        thread threadPengguna([this]() { autentikasi->muatDataPengguna(); });
+        thread threadKamar([this, &kamarLoaded]() {
+            kamarLoaded = manajemenKamar->muatDataKamar();
+        });
+        thread threadLayanan([this, &layananLoaded]() {
+            layananLoaded = manajemenLayanan->muatDataLayanan();
+        });
+        
+        sistemPembayaran->muatDataTransaksi(jumlahCore);
+        
+        threadPengguna.join();
+        threadKamar.join();
+        threadLayanan.join();
+    }
 
 public:
     // Constructor
     DataManager(SistemAutentikasi* auth, ManajemenKamar* kamar,
                 ManajemenLayanan* layanan, SistemPembayaran* pembayaran)
         : autentikasi(auth), manajemenKamar(kamar), 
-          manajemenLayanan(layanan), sistemPembayaran(pembayaran) {}
+          manajemenLayanan(layanan), sistemPembayaran(pembayaran),
+          modeParalel(thread::hardware_concurrency() > 1) {
+        // Okupansi kamar diisi dari transaksi (lazy, saat pertama dibutuhkan)
+        sistemPembayaran->setKalender(&manajemenKamar->getKalender());
+    }
+    
+    // Aktifkan/nonaktifkan load paralel (default: aktif jika core > 1)
+    void setModeParalel(bool paralel) { modeParalel = paralel; }
     
     // Load semua data dari file
     bool muatSemuaData() {
+        bool kamarLoaded = false;
+        bool layananLoaded = false;
+        
         // Silent load - no messages
-        bool authLoaded = autentikasi->muatDataPengguna();
-        bool kamarLoaded = manajemenKamar->muatDataKamar();
-        bool layananLoaded = manajemenLayanan->muatDataLayanan();
-        bool transaksiLoaded = sistemPembayaran->muatDataTransaksi();
+        if (!muatSnapshot(kamarLoaded, layananLoaded)) {
+            if (modeParalel) {
+                muatFileTeksParalel(kamarLoaded, layananLoaded);
+            } else {
+                autentikasi->muatDataPengguna();
+                kamarLoaded = manajemenKamar->muatDataKamar();
+                layananLoaded = manajemenLayanan->muatDataLayanan();
+                sistemPembayaran->muatDataTransaksi();
+            }
+        }
         
         // Jika data kosong, inisialisasi default (silent)
         if (!kamarLoaded || manajemenKamar->getJumlahKamar() == 0) {
@@ -83,61 +180,61 @@ public:
     void inisialisasiDataLayananDefault() {
         // Ballroom (2 jenis)
         manajemenLayanan->tambahLayanan(KategoriLayanan::BALLROOM, 
-            "Grand Ballroom", 5000000, 1, 
+            "Grand Ballroom", Rupiah::dariRupiah(5000000), 1, 
             "Kapasitas 500 orang - Cocok untuk wedding & seminar besar");
         
         manajemenLayanan->tambahLayanan(KategoriLayanan::BALLROOM, 
-            "Meeting Room Premium", 2000000, 1,
+            "Meeting Room Premium", Rupiah::dariRupiah(2000000), 1,
             "Kapasitas 100 orang - Untuk meeting & workshop");
         
         // Restaurant (2 jenis)
         manajemenLayanan->tambahLayanan(KategoriLayanan::RESTAURANT, 
-            "Fine Dining Prasmanan", 200000, 1,
+            "Fine Dining Prasmanan", Rupiah::dariRupiah(200000), 1,
             "Menu prasmanan internasional - Breakfast, lunch, dinner");
         
         manajemenLayanan->tambahLayanan(KategoriLayanan::RESTAURANT, 
-            "A La Carte Premium", 150000, 1,
+            "A La Carte Premium", Rupiah::dariRupiah(150000), 1,
             "Menu pilihan chef - Makanan kelas dunia");
         
         // Laundry
         manajemenLayanan->tambahLayanan(KategoriLayanan::LAUNDRY, 
-            "Laundry Express", 15000, 1,
+            "Laundry Express", Rupiah::dariRupiah(15000), 1,
             "Cuci + setrika + pewangi - Selesai 1 hari");
         
         manajemenLayanan->tambahLayanan(KategoriLayanan::LAUNDRY, 
-            "Laundry Regular", 10000, 1,
+            "Laundry Regular", Rupiah::dariRupiah(10000), 1,
             "Cuci + setrika - Selesai 2-3 hari");
         
         // Kolam Renang
         manajemenLayanan->tambahLayanan(KategoriLayanan::KOLAM_RENANG, 
-            "Pool Access Full Day", 50000, 1,
+            "Pool Access Full Day", Rupiah::dariRupiah(50000), 1,
             "Akses kolam renang seharian - Jam 06:00-22:00");
         
         // Gym & Fitness
         manajemenLayanan->tambahLayanan(KategoriLayanan::GYM, 
-            "Gym + Personal Trainer", 150000, 1,
+            "Gym + Personal Trainer", Rupiah::dariRupiah(150000), 1,
             "1 sesi gym dengan personal trainer - 1.5 jam");
         
         manajemenLayanan->tambahLayanan(KategoriLayanan::GYM, 
-            "Gym Access Only", 75000, 1,
+            "Gym Access Only", Rupiah::dariRupiah(75000), 1,
             "Akses gym tanpa trainer - Unlimited time");
         
         // Transfer Bandara
         manajemenLayanan->tambahLayanan(KategoriLayanan::TRANSFER_BANDARA, 
-            "Airport Shuttle - Sedan", 300000, 1,
+            "Airport Shuttle - Sedan", Rupiah::dariRupiah(300000), 1,
             "Antar-jemput bandara dengan sedan - Max 4 pax");
         
         manajemenLayanan->tambahLayanan(KategoriLayanan::TRANSFER_BANDARA, 
-            "Airport Shuttle - Van", 500000, 1,
+            "Airport Shuttle - Van", Rupiah::dariRupiah(500000), 1,
             "Antar-jemput bandara dengan van - Max 8 pax");
         
         // Catering
         manajemenLayanan->tambahLayanan(KategoriLayanan::CATERING, 
-            "Catering Premium Package", 150000, 20,
+            "Catering Premium Package", Rupiah::dariRupiah(150000), 20,
             "Paket catering premium untuk event - Min 20 pax");
         
         manajemenLayanan->tambahLayanan(KategoriLayanan::CATERING, 
-            "Catering VIP Package", 250000, 50,
+            "Catering VIP Package", Rupiah::dariRupiah(250000), 50,
             "Paket catering VIP untuk event besar - Min 50 pax");
         
         // Silent init
@@ -150,8 +247,11 @@ public:
         bool authSaved = autentikasi->simpanDataPengguna();
         bool kamarSaved = manajemenKamar->simpanDataKamar();
         bool layananSaved = manajemenLayanan->simpanDataLayanan();
+        bool transaksiSaved = sistemPembayaran->kompaksiLog();
         
-        if (authSaved && kamarSaved && layananSaved) {
+        if (authSaved && kamarSaved && layananSaved && transaksiSaved) {
+            // Snapshot ditulis terakhir agar mencatat kondisi file teks yang final
+            simpanSnapshot();
             cout << "[SUKSES] Semua data berhasil disimpan!" << endl;
             return true;
         }
@@ -192,6 +292,10 @@ public:
         PengelolaFile::hapusFile("kamar.txt");
         PengelolaFile::hapusFile("layanan.txt");
         PengelolaFile::hapusFile("transaksi.txt");
+        manajemenKamar->kosongkanLog();
+        manajemenLayanan->kosongkanLog();
+        sistemPembayaran->kosongkanLog();
+        PengelolaFile::hapusFile(fileSnapshot());
         
         // Reinisialisasi
         PengelolaFile::buatFileJikaBelumAda("pengguna.txt");
@@ -211,16 +315,16 @@ public:
     bool backupData() {
         cout << "\n[INFO] Membuat backup data..." << endl;
         
-        // Baca semua file
-        string penggunaBackup[1000], kamarBackup[1000], layananBackup[1000];
-        int jPengguna = PengelolaFile::bacaSemuaBaris("pengguna.txt", penggunaBackup, 1000);
-        int jKamar = PengelolaFile::bacaSemuaBaris("kamar.txt", kamarBackup, 1000);
-        int jLayanan = PengelolaFile::bacaSemuaBaris("layanan.txt", layananBackup, 1000);
+        // Kompaksi dulu: perubahan terbaru kamar & layanan masih di file .log
+        if (!manajemenKamar->simpanDataKamar() || !manajemenLayanan->simpanDataLayanan()) {
+            cout << "[ERROR] Gagal membuat backup!" << endl;
+            return false;
+        }
         
-        // Simpan ke file backup
-        bool b1 = PengelolaFile::tulisSemuaBaris("pengguna_backup.txt", penggunaBackup, jPengguna);
-        bool b2 = PengelolaFile::tulisSemuaBaris("kamar_backup.txt", kamarBackup, jKamar);
-        bool b3 = PengelolaFile::tulisSemuaBaris("layanan_backup.txt", layananBackup, jLayanan);
+        // Salin setiap file ke file backup (streaming, tanpa batas baris)
+        bool b1 = PengelolaFile::salinBaris("pengguna.txt", "pengguna_backup.txt");
+        bool b2 = PengelolaFile::salinBaris("kamar.txt", "kamar_backup.txt");
+        bool b3 = PengelolaFile::salinBaris("layanan.txt", "layanan_backup.txt");
         
         if (b1 && b2 && b3) {
             cout << "[SUKSES] Backup berhasil dibuat!" << endl;
@@ -76,7 +76,7 @@ public:
             return false;
         }
         
-        user->setNama(namaBaru);
+        autentikasi->ubahNamaPengguna(user, namaBaru);
         autentikasi->simpanDataPengguna();
         
         cout << "\n[SUKSES] Nama berhasil diubah!" << endl;
@@ -101,14 +101,9 @@ public:
         }
         
         // Cek apakah email sudah digunakan user lain
-        bool emailSudahAda = false;
-        autentikasi->getDaftarPengguna().iterasi([&](Pengguna* p) {
-            if (p != user && p->getEmail() == emailBaru) {
-                emailSudahAda = true;
-            }
-        });
+        Pengguna* pemilikEmail = autentikasi->cariPenggunaByEmail(emailBaru);
         
-        if (emailSudahAda) {
+        if (pemilikEmail != nullptr && pemilikEmail != user) {
             cout << "[ERROR] Email sudah digunakan oleh user lain!" << endl;
             return false;
         }
@@ -118,7 +113,7 @@ public:
             return false;
         }
         
-        user->setEmail(emailBaru);
+        autentikasi->ubahEmailPengguna(user, emailBaru);
         autentikasi->simpanDataPengguna();
         
         cout << "\n[SUKSES] Email berhasil diubah!" << endl;
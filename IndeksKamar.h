@@ -0,0 +1,431 @@
+#ifndef INDEKS_KAMAR_H
+#define INDEKS_KAMAR_H
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+#include "TabelHash.h"
+#include "KolomKamar.h"
+#include "Kamar.h"
+using namespace std;
+
+// ============================================================================
+// INDEKS KAMAR - INDEX MULTI-ATRIBUT (BITMAP)
+// ============================================================================
+// Digunakan oleh: ManajemenKamar (pencarian kamar by tipe/status/lantai/
+//                 kapasitas/harga/fasilitas tanpa scan seluruh list)
+// Setiap kamar mendapat satu slot (nomor bit) saat didaftarkan:
+// - Bitmap per tipe, per status, balkon, pemandangan laut
+// - Bucket bitmap per lantai & per kapasitas (range = OR beberapa bucket)
+// - Array slot terurut harga: diurutkan ulang saat pencarian setelah kamar
+//   ditambah, perubahan harga / hapus cukup menggeser satu entri
+// - Salinan atribut per kolom (KolomKamar) dengan nomor slot yang sama
+// Pencarian = AND bitmap per kriteria, lalu hanya bit yang tersisa yang
+// dikunjungi. Kandidat dicek sekali lagi di KolomKamar tanpa membuka objek
+// kamar (lantai/kapasitas di luar jangkauan bucket digabung ke bucket terakhir)
+// Slot kamar yang dihapus tidak dipakai ulang sampai index dibangun ulang
+// Ringkasan statistik (per status/tipe/lantai) dijaga incremental di setiap
+// tambah/perbarui/hapus, sehingga layar statistik tidak perlu scan ulang.
+// Compile dengan -DPERIKSA_STATISTIK untuk mencocokkannya dengan hitung ulang
+// dari nol (KolomKamar::hitungRingkasan) setiap kali diambil
+// ============================================================================
+
+// ============================================================================
+// KUMPULAN BITMAP - BEBERAPA BITMAP DENGAN LEBAR SAMA (BARIS x WORD)
+// ============================================================================
+class KumpulanBitmap {
+private:
+    uint64_t* bit;
+    int jumlahBaris;
+    int jumlahWord;
+
+public:
+    // Constructor
+    KumpulanBitmap() : bit(nullptr), jumlahBaris(0), jumlahWord(0) {}
+    
+    // Destructor
+    ~KumpulanBitmap() {
+        delete[] bit;
+    }
+    
+    // Dimiliki oleh satu index, tidak boleh di-copy
+    KumpulanBitmap(const KumpulanBitmap&) = delete;
+    KumpulanBitmap& operator=(const KumpulanBitmap&) = delete;
+    
+    // Perbesar jumlah bitmap / lebar bitmap (isi lama dipertahankan)
+    void aturUkuran(int barisBaru, int wordBaru) {
+        if (barisBaru <= jumlahBaris && wordBaru <= jumlahWord) return;
+        if (barisBaru < jumlahBaris) barisBaru = jumlahBaris;
+        if (wordBaru < jumlahWord) wordBaru = jumlahWord;
+        
+        uint64_t* bitBaru = new uint64_t[(size_t)barisBaru * wordBaru]();
+        for (int b = 0; b < jumlahBaris && jumlahWord > 0; b++) {
+            memcpy(bitBaru + (size_t)b * wordBaru, bit + (size_t)b * jumlahWord,
+                   sizeof(uint64_t) * jumlahWord);
+        }
+        
+        delete[] bit;
+        bit = bitBaru;
+        jumlahBaris = barisBaru;
+        jumlahWord = wordBaru;
+    }
+    
+    void set(int b, int slot) {
+        bit[(size_t)b * jumlahWord + slot / 64] |= 1ULL << (slot % 64);
+    }
+    
+    void reset(int b, int slot) {
+        bit[(size_t)b * jumlahWord + slot / 64] &= ~(1ULL << (slot % 64));
+    }
+    
+    const uint64_t* baris(int b) const {
+        return bit + (size_t)b * jumlahWord;
+    }
+    
+    // Kosongkan semua bit (ukuran tetap)
+    void clear() {
+        if (bit != nullptr) {
+            memset(bit, 0, sizeof(uint64_t) * (size_t)jumlahBaris * jumlahWord);
+        }
+    }
+    
+    int getJumlahBaris() const { return jumlahBaris; }
+    int getJumlahWord() const { return jumlahWord; }
+};
+
+// ============================================================================
+// INDEKS KAMAR
+// ============================================================================
+class IndeksKamar {
+private:
+    // Baris bitmap atribut
+    static const int BIT_HIDUP = 0;     // Slot berisi kamar (belum dihapus)
+    static const int BIT_TIPE = 1;      // 4 baris, urutan TipeKamar
+    static const int BIT_STATUS = 5;    // 4 baris, urutan StatusKamar
+    static const int BIT_BALKON = 9;
+    static const int BIT_LAUT = 10;
+    static const int JUMLAH_BIT_ATRIBUT = 11;
+    
+    static const int SLOT_AWAL = 64;
+    static const int BATAS_BUCKET = 128; // Lantai/kapasitas >= ini masuk bucket terakhir
+    
+    Kamar** kamarSlot;              // Slot -> kamar (nullptr = dihapus)
+    KolomKamar kolom;               // Slot -> atribut (status, tipe, harga, ...)
+    RingkasanKamar ringkasan;       // Statistik incremental semua slot hidup
+    int jumlahSlot;
+    int kapasitasSlot;
+    TabelHash<int> indexSlot;       // Nomor kamar -> slot
+    
+    KumpulanBitmap atribut;
+    KumpulanBitmap bucketLantai;
+    KumpulanBitmap bucketKapasitas;
+    
+    int* urutHarga;                 // Slot hidup, terurut harga
+    int64_t* hargaUrut;             // Harga (sen) sesuai urutHarga
+    int jumlahUrut;
+    bool urutHargaValid;
+    
+    uint64_t* hasil;                // Buffer kerja pencarian (jumlahWord)
+    uint64_t* sementara;
+    
+    static int bucket(int nilai) {
+        if (nilai < 0) return 0;
+        return (nilai >= BATAS_BUCKET) ? BATAS_BUCKET - 1 : nilai;
+    }
+    
+    int jumlahWord() const {
+        return kapasitasSlot / 64;
+    }
+    
+    // Helper: Perbesar slot (naik 2x), semua bitmap ikut melebar
+    void pastikanSlot() {
+        if (jumlahSlot < kapasitasSlot) return;
+        
+        int kapasitasBaru = (kapasitasSlot == 0) ? SLOT_AWAL : kapasitasSlot * 2;
+        Kamar** slotBaru = new Kamar*[kapasitasBaru];
+        for (int s = 0; s < jumlahSlot; s++) {
+            slotBaru[s] = kamarSlot[s];
+        }
+        delete[] kamarSlot;
+        kamarSlot = slotBaru;
+        kapasitasSlot = kapasitasBaru;
+        kolom.reservasi(kapasitasBaru);
+        
+        atribut.aturUkuran(JUMLAH_BIT_ATRIBUT, jumlahWord());
+        bucketLantai.aturUkuran(bucketLantai.getJumlahBaris(), jumlahWord());
+        bucketKapasitas.aturUkuran(bucketKapasitas.getJumlahBaris(), jumlahWord());
+        
+        delete[] hasil;
+        delete[] sementara;
+        hasil = new uint64_t[jumlahWord()];
+        sementara = new uint64_t[jumlahWord()];
+    }
+    
+    // Helper: Set bit status sesuai status kamar saat ini
+    void aturStatus(int slot, StatusKamar status) {
+        for (int i = 0; i < 4; i++) {
+            atribut.reset(BIT_STATUS + i, slot);
+        }
+        atribut.set(BIT_STATUS + static_cast<int>(status), slot);
+    }
+    
+    int cariSlot(const string& nomor) const {
+        const int* slot = indexSlot.search(nomor);
+        return (slot != nullptr) ? *slot : -1;
+    }
+    
+    // Helper: Urutkan slot hidup berdasarkan harga (hanya jika ada perubahan)
+    void siapkanUrutHarga() {
+        if (urutHargaValid) return;
+        
+        delete[] urutHarga;
+        delete[] hargaUrut;
+        urutHarga = new int[jumlahSlot > 0 ? jumlahSlot : 1];
+        hargaUrut = new int64_t[jumlahSlot > 0 ? jumlahSlot : 1];
+        
+        // Urutkan pasangan (harga, slot) agar sort tidak membaca objek kamar
+        pair<int64_t, int>* pasangan = new pair<int64_t, int>[jumlahSlot > 0 ? jumlahSlot : 1];
+        jumlahUrut = 0;
+        for (int s = 0; s < jumlahSlot; s++) {
+            if (kamarSlot[s] != nullptr) {
+                pasangan[jumlahUrut++] = make_pair(kolom.getHarga(s), s);
+            }
+        }
+        
+        sort(pasangan, pasangan + jumlahUrut);
+        for (int i = 0; i < jumlahUrut; i++) {
+            hargaUrut[i] = pasangan[i].first;
+            urutHarga[i] = pasangan[i].second;
+        }
+        delete[] pasangan;
+        
+        urutHargaValid = true;
+    }
+    
+    // Helper: Keluarkan slot dari urutan harga (geser entri sesudahnya)
+    void keluarkanDariUrutan(int slot) {
+        int i = (int)(lower_bound(hargaUrut, hargaUrut + jumlahUrut, kolom.getHarga(slot)) - hargaUrut);
+        while (i < jumlahUrut && urutHarga[i] != slot) i++;
+        if (i == jumlahUrut) return;
+        
+        memmove(urutHarga + i, urutHarga + i + 1, sizeof(int) * (jumlahUrut - i - 1));
+        memmove(hargaUrut + i, hargaUrut + i + 1, sizeof(int64_t) * (jumlahUrut - i - 1));
+        jumlahUrut--;
+    }
+    
+    // Helper: Sisipkan slot ke urutan harga (kapasitas sisa dari keluarkan)
+    void sisipkanKeUrutan(int slot) {
+        int i = (int)(upper_bound(hargaUrut, hargaUrut + jumlahUrut, kolom.getHarga(slot)) - hargaUrut);
+        
+        memmove(urutHarga + i + 1, urutHarga + i, sizeof(int) * (jumlahUrut - i));
+        memmove(hargaUrut + i + 1, hargaUrut + i, sizeof(int64_t) * (jumlahUrut - i));
+        urutHarga[i] = slot;
+        hargaUrut[i] = kolom.getHarga(slot);
+        jumlahUrut++;
+    }
+    
+    // Helper: hasil &= baris
+    void irisan(const uint64_t* baris) {
+        for (int w = 0; w < jumlahWord(); w++) {
+            hasil[w] &= baris[w];
+        }
+    }
+    
+    // Helper: hasil &= OR bucket [awal, akhir]
+    void irisanBucket(const KumpulanBitmap& bucketBitmap, int awal, int akhir) {
+        memset(sementara, 0, sizeof(uint64_t) * jumlahWord());
+        if (akhir >= bucketBitmap.getJumlahBaris()) akhir = bucketBitmap.getJumlahBaris() - 1;
+        
+        for (int b = awal; b <= akhir; b++) {
+            const uint64_t* baris = bucketBitmap.baris(b);
+            for (int w = 0; w < jumlahWord(); w++) {
+                sementara[w] |= baris[w];
+            }
+        }
+        irisan(sementara);
+    }
+    
+    // Helper: hasil &= slot dengan harga di [hargaMin, hargaMaks]
+    void irisanHarga(const Rupiah& hargaMin, const Rupiah& hargaMaks) {
+        siapkanUrutHarga();
+        
+        int awal = (int)(lower_bound(hargaUrut, hargaUrut + jumlahUrut, hargaMin.getSen()) - hargaUrut);
+        int akhir = (int)(upper_bound(hargaUrut, hargaUrut + jumlahUrut, hargaMaks.getSen()) - hargaUrut);
+        
+        memset(sementara, 0, sizeof(uint64_t) * jumlahWord());
+        for (int i = awal; i < akhir; i++) {
+            sementara[urutHarga[i] / 64] |= 1ULL << (urutHarga[i] % 64);
+        }
+        irisan(sementara);
+    }
+
+public:
+    // Constructor
+    IndeksKamar()
+        : kamarSlot(nullptr), ringkasan(), jumlahSlot(0), kapasitasSlot(0),
+          urutHarga(nullptr), hargaUrut(nullptr), jumlahUrut(0), urutHargaValid(true),
+          hasil(nullptr), sementara(nullptr) {}
+    
+    // Destructor (kamar dimiliki ManajemenKamar, tidak di-delete di sini)
+    ~IndeksKamar() {
+        delete[] kamarSlot;
+        delete[] urutHarga;
+        delete[] hargaUrut;
+        delete[] hasil;
+        delete[] sementara;
+    }
+    
+    // Index dimiliki oleh ManajemenKamar, tidak boleh di-copy
+    IndeksKamar(const IndeksKamar&) = delete;
+    IndeksKamar& operator=(const IndeksKamar&) = delete;
+    
+    // Daftarkan kamar baru (tidak berubah jika nomor sudah terdaftar)
+    void tambah(Kamar* kamar) {
+        if (cariSlot(kamar->getNomorKamar()) >= 0) return;
+        
+        pastikanSlot();
+        int slot = jumlahSlot++;
+        kamarSlot[slot] = kamar;
+        kolom.isi(slot, *kamar);
+        kolom.catatRingkasan(ringkasan, slot, 1);
+        indexSlot.insert(slot, kamar->getNomorKamar());
+        
+        atribut.set(BIT_HIDUP, slot);
+        atribut.set(BIT_TIPE + static_cast<int>(kamar->getTipe()), slot);
+        aturStatus(slot, kamar->getStatus());
+        if (kamar->hasBalkon()) atribut.set(BIT_BALKON, slot);
+        if (kamar->hasPemandanganLaut()) atribut.set(BIT_LAUT, slot);
+        
+        int lantai = bucket(kamar->getLantai());
+        int kapasitas = bucket(kamar->getKapasitasOrang());
+        bucketLantai.aturUkuran(lantai + 1, jumlahWord());
+        bucketKapasitas.aturUkuran(kapasitas + 1, jumlahWord());
+        bucketLantai.set(lantai, slot);
+        bucketKapasitas.set(kapasitas, slot);
+        
+        urutHargaValid = false;
+    }
+    
+    // Sinkronkan status & harga kamar (atribut lain tidak bisa berubah)
+    void perbarui(const Kamar* kamar) {
+        int slot = cariSlot(kamar->getNomorKamar());
+        if (slot < 0) return;
+        
+        aturStatus(slot, kamar->getStatus());
+        kolom.catatRingkasan(ringkasan, slot, -1);
+        kolom.setStatus(slot, kamar->getStatus());
+        kolom.catatRingkasan(ringkasan, slot, 1);
+        
+        int64_t hargaBaru = kamar->getHargaPerMalam().getSen();
+        if (hargaBaru != kolom.getHarga(slot)) {
+            if (urutHargaValid) keluarkanDariUrutan(slot);
+            kolom.setHarga(slot, hargaBaru);
+            if (urutHargaValid) sisipkanKeUrutan(slot);
+        }
+    }
+    
+    // Hapus kamar dari index (semua bit slot dikosongkan)
+    void hapus(const string& nomor) {
+        int slot = cariSlot(nomor);
+        if (slot < 0) return;
+        
+        for (int b = 0; b < JUMLAH_BIT_ATRIBUT; b++) atribut.reset(b, slot);
+        for (int b = 0; b < bucketLantai.getJumlahBaris(); b++) bucketLantai.reset(b, slot);
+        for (int b = 0; b < bucketKapasitas.getJumlahBaris(); b++) bucketKapasitas.reset(b, slot);
+        
+        if (urutHargaValid) keluarkanDariUrutan(slot);
+        kolom.catatRingkasan(ringkasan, slot, -1);
+        kolom.hapus(slot);
+        kamarSlot[slot] = nullptr;
+        indexSlot.hapus(nomor);
+    }
+    
+    // Kosongkan index (kapasitas dipakai ulang)
+    void clear() {
+        jumlahSlot = 0;
+        indexSlot.clear();
+        kolom.clear();
+        memset(&ringkasan, 0, sizeof(ringkasan));
+        atribut.clear();
+        bucketLantai.clear();
+        bucketKapasitas.clear();
+        jumlahUrut = 0;
+        urutHargaValid = true;
+    }
+    
+    // Panggil func(Kamar*) untuk setiap kamar yang cocok (urutan slot =
+    // urutan kamar didaftarkan). Return jumlah kamar yang cocok
+    template<typename Function>
+    int cari(const KriteriaKamar& kriteria, Function func) {
+        if (jumlahSlot == 0) return 0;
+        
+        memcpy(hasil, atribut.baris(BIT_HIDUP), sizeof(uint64_t) * jumlahWord());
+        
+        if (kriteria.pakaiTipe) irisan(atribut.baris(BIT_TIPE + static_cast<int>(kriteria.tipe)));
+        if (kriteria.pakaiStatus) irisan(atribut.baris(BIT_STATUS + static_cast<int>(kriteria.status)));
+        if (kriteria.harusBalkon) irisan(atribut.baris(BIT_BALKON));
+        if (kriteria.harusPemandanganLaut) irisan(atribut.baris(BIT_LAUT));
+        
+        if (kriteria.pakaiLantai) {
+            if (kriteria.lantaiMaks < kriteria.lantaiMin) return 0;
+            irisanBucket(bucketLantai, bucket(kriteria.lantaiMin), bucket(kriteria.lantaiMaks));
+        }
+        if (kriteria.kapasitasMin > 0) {
+            irisanBucket(bucketKapasitas, bucket(kriteria.kapasitasMin), BATAS_BUCKET - 1);
+        }
+        if (kriteria.pakaiHarga) {
+            if (kriteria.hargaMaks < kriteria.hargaMin) return 0;
+            irisanHarga(kriteria.hargaMin, kriteria.hargaMaks);
+        }
+        
+        // Kunjungi bit yang tersisa saja (bit terendah dihapus satu per satu)
+        KolomKamar::Predikat predikat(kriteria);
+        int jumlah = 0;
+        int wordTerpakai = (jumlahSlot + 63) / 64;
+        for (int w = 0; w < wordTerpakai; w++) {
+            uint64_t word = hasil[w];
+            while (word != 0) {
+                int slot = w * 64 + __builtin_ctzll(word);
+                word &= word - 1;
+                
+                if (kolom.cocok(predikat, slot)) {
+                    jumlah++;
+                    func(kamarSlot[slot]);
+                }
+            }
+        }
+        return jumlah;
+    }
+    
+    // Hitung kamar yang cocok tanpa bitmap (scan kolom, tanpa membuka objek)
+    int hitung(const KriteriaKamar& kriteria) const {
+        return kolom.hitung(kriteria);
+    }
+    
+    // Cocokkan ringkasan incremental dengan hitung ulang dari nol
+    bool periksaKonsistensi() const {
+        RingkasanKamar hitungUlang;
+        kolom.hitungRingkasan(hitungUlang);
+        return memcmp(&hitungUlang, &ringkasan, sizeof(ringkasan)) == 0 &&
+               ringkasan.total == indexSlot.ukuran();
+    }
+    
+    // Ringkasan statistik terkini - O(1)
+    // PERIKSA_STATISTIK: diperiksa terhadap hitung ulang setiap kali diambil
+    const RingkasanKamar& getRingkasan() const {
+#ifdef PERIKSA_STATISTIK
+        if (!periksaKonsistensi()) {
+            cout << "[ERROR] Ringkasan kamar tidak sama dengan hitung ulang!" << endl;
+        }
+#endif
+        return ringkasan;
+    }
+    
+    // Getter
+    int getJumlahKamar() const { return indexSlot.ukuran(); }
+    const KolomKamar& getKolom() const { return kolom; }
+};
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef INDEKS_KUNCI_H
+#define INDEKS_KUNCI_H
+
+#include "IndeksTerurut.h"
+#include "BinarySearchTree.h"
+
+// ============================================================================
+// INDEKS KUNCI - PILIHAN STRUKTUR INDEX BY KEY
+// ============================================================================
+// Digunakan oleh: ManajemenKamar (indexKamar), ManajemenLayanan (indexLayanan)
+// Struktur dipilih per index lewat parameter template ketiga, interface sama
+// (insert, search, hapus, clear, bangunDariTerurut, inorder, kedalaman, tampilkan):
+// - StrukturIndeks::TERURUT : IndeksTerurut (sorted array, binary search)
+// - StrukturIndeks::AVL     : BinarySearchTree mode AVL (insert/hapus O(log n))
+// - StrukturIndeks::BST     : BinarySearchTree mode BIASA (tanpa penyeimbangan)
+// ============================================================================
+
+enum class StrukturIndeks {
+    TERURUT,    // Sorted array (default)
+    BST,        // BST biasa
+    AVL         // BST self-balancing
+};
+
+template<typename T, typename KeyType, StrukturIndeks S = StrukturIndeks::TERURUT>
+class IndeksKunci : public IndeksTerurut<T, KeyType> {};
+
+template<typename T, typename KeyType>
+class IndeksKunci<T, KeyType, StrukturIndeks::BST> : public BinarySearchTree<T, KeyType> {
+public:
+    IndeksKunci() : BinarySearchTree<T, KeyType>(ModeBST::BIASA) {}
+};
+
+template<typename T, typename KeyType>
+class IndeksKunci<T, KeyType, StrukturIndeks::AVL> : public BinarySearchTree<T, KeyType> {
+public:
+    IndeksKunci() : BinarySearchTree<T, KeyType>(ModeBST::AVL) {}
+};
+
+#endif
@@ -0,0 +1,253 @@
+#ifndef INDEKS_TERURUT_H
+#define INDEKS_TERURUT_H
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <utility>
+using namespace std;
+
+// ============================================================================
+// INDEKS TERURUT - SORTED ARRAY INDEX
+// ============================================================================
+// Alternatif BinarySearchTree untuk index yang jarang berubah (read-mostly)
+// Contoh penggunaan: index nomor kamar, index ID layanan
+// Key & data disimpan di dua array bersebelahan yang selalu terurut:
+// - Search   : binary search O(log n) di array key (tanpa pointer chasing)
+// - Range    : scan linear di memori yang bersebelahan
+// - Insert/hapus : O(n) karena elemen digeser
+// Interface sama dengan BinarySearchTree<T, KeyType>
+// ============================================================================
+
+template<typename T, typename KeyType>
+class IndeksTerurut {
+private:
+    KeyType* daftarKey;
+    T* daftarData;
+    int jumlahData;
+    int kapasitas;
+    
+    static const int KAPASITAS_AWAL = 16;
+    
+    // Helper: Index pertama dengan key >= key yang dicari (lower bound)
+    int posisiBawah(const KeyType& key) const {
+        int kiri = 0;
+        int kanan = jumlahData;
+        
+        while (kiri < kanan) {
+            int tengah = kiri + (kanan - kiri) / 2;
+            if (daftarKey[tengah] < key) {
+                kiri = tengah + 1;
+            } else {
+                kanan = tengah;
+            }
+        }
+        
+        return kiri;
+    }
+    
+    // Helper: Index key yang dicari, -1 jika tidak ada
+    int cariPosisi(const KeyType& key) const {
+        int posisi = posisiBawah(key);
+        
+        if (posisi < jumlahData && daftarKey[posisi] == key) {
+            return posisi;
+        }
+        
+        return -1;
+    }
+    
+    // Helper: Pastikan kapasitas cukup (naik 2x)
+    void pastikanKapasitas(int dibutuhkan) {
+        if (dibutuhkan <= kapasitas) return;
+        
+        int kapasitasBaru = (kapasitas == 0) ? KAPASITAS_AWAL : kapasitas;
+        while (kapasitasBaru < dibutuhkan) {
+            kapasitasBaru *= 2;
+        }
+        
+        KeyType* keyBaru = new KeyType[kapasitasBaru];
+        T* dataBaru = new T[kapasitasBaru];
+        
+        for (int i = 0; i < jumlahData; i++) {
+            keyBaru[i] = std::move(daftarKey[i]);
+            dataBaru[i] = std::move(daftarData[i]);
+        }
+        
+        delete[] daftarKey;
+        delete[] daftarData;
+        daftarKey = keyBaru;
+        daftarData = dataBaru;
+        kapasitas = kapasitasBaru;
+    }
+
+public:
+    // Constructor
+    IndeksTerurut()
+        : daftarKey(nullptr), daftarData(nullptr), jumlahData(0), kapasitas(0) {}
+    
+    // Destructor
+    ~IndeksTerurut() {
+        delete[] daftarKey;
+        delete[] daftarData;
+    }
+    
+    // Index dimiliki oleh satu manager, tidak boleh di-copy
+    IndeksTerurut(const IndeksTerurut&) = delete;
+    IndeksTerurut& operator=(const IndeksTerurut&) = delete;
+    
+    // Cek apakah index kosong
+    bool kosong() const {
+        return jumlahData == 0;
+    }
+    
+    // Dapatkan jumlah data
+    int ukuran() const {
+        return jumlahData;
+    }
+    
+    // Insert data dengan key (key sudah ada: data di-update)
+    void insert(const T& data, const KeyType& key) {
+        int posisi = posisiBawah(key);
+        
+        if (posisi < jumlahData && daftarKey[posisi] == key) {
+            daftarData[posisi] = data;
+            return;
+        }
+        
+        pastikanKapasitas(jumlahData + 1);
+        
+        // Geser elemen setelah posisi ke kanan
+        for (int i = jumlahData; i > posisi; i--) {
+            daftarKey[i] = std::move(daftarKey[i - 1]);
+            daftarData[i] = std::move(daftarData[i - 1]);
+        }
+        
+        daftarKey[posisi] = key;
+        daftarData[posisi] = data;
+        jumlahData++;
+    }
+    
+    // Search data berdasarkan key
+    T* search(const KeyType& key) {
+        int posisi = cariPosisi(key);
+        return (posisi >= 0) ? &daftarData[posisi] : nullptr;
+    }
+    
+    // Search const version
+    const T* search(const KeyType& key) const {
+        int posisi = cariPosisi(key);
+        return (posisi >= 0) ? &daftarData[posisi] : nullptr;
+    }
+    
+    // Hapus data berdasarkan key
+    bool hapus(const KeyType& key) {
+        int posisi = cariPosisi(key);
+        if (posisi < 0) return false;
+        
+        // Geser elemen setelah posisi ke kiri
+        for (int i = posisi; i < jumlahData - 1; i++) {
+            daftarKey[i] = std::move(daftarKey[i + 1]);
+            daftarData[i] = std::move(daftarData[i + 1]);
+        }
+        
+        jumlahData--;
+        return true;
+    }
+    
+    // Clear semua data (kapasitas tetap dipakai ulang)
+    void clear() {
+        jumlahData = 0;
+    }
+    
+    // Bangun ulang index dari array data & key sekaligus (isi lama dihapus)
+    // O(n) jika key sudah terurut, selain itu diurutkan sekali O(n log n)
+    // Key duplikat: data terakhir yang dipakai (sama seperti insert)
+    void bangunDariTerurut(const T* data, const KeyType* kunci, int n) {
+        clear();
+        if (n <= 0) return;
+        
+        pastikanKapasitas(n);
+        
+        int* urutan = new int[n];
+        bool terurut = true;
+        for (int i = 0; i < n; i++) {
+            urutan[i] = i;
+            if (i > 0 && kunci[i] < kunci[i - 1]) {
+                terurut = false;
+            }
+        }
+        
+        if (!terurut) {
+            stable_sort(urutan, urutan + n, [kunci](int a, int b) {
+                return kunci[a] < kunci[b];
+            });
+        }
+        
+        // Copy key/data bisa melempar, buffer tetap dibebaskan (isi index
+        // tinggal prefix yang sudah tersalin, tetap terurut)
+        try {
+            for (int i = 0; i < n; i++) {
+                const KeyType& key = kunci[urutan[i]];
+                
+                if (jumlahData > 0 && daftarKey[jumlahData - 1] == key) {
+                    daftarData[jumlahData - 1] = data[urutan[i]];
+                } else {
+                    daftarKey[jumlahData] = key;
+                    daftarData[jumlahData] = data[urutan[i]];
+                    jumlahData++;
+                }
+            }
+        } catch (...) {
+            delete[] urutan;
+            throw;
+        }
+        
+        delete[] urutan;
+    }
+    
+    // Inorder traversal (terurut ascending)
+    template<typename Function>
+    void inorder(Function func) const {
+        for (int i = 0; i < jumlahData; i++) {
+            func(daftarData[i]);
+        }
+    }
+    
+    // Jumlah langkah binary search terburuk (padanan kedalaman tree)
+    int kedalaman() const {
+        int langkah = 0;
+        for (int n = jumlahData; n > 0; n /= 2) {
+            langkah++;
+        }
+        return langkah;
+    }
+    
+    // Tampilkan index (terurut)
+    void tampilkan() const {
+        if (kosong()) {
+            cout << "[Index Kosong]" << endl;
+            return;
+        }
+        
+        cout << "\n=== Indeks Terurut ===" << endl;
+        cout << "Jumlah Data: " << jumlahData << endl;
+        cout << "-----------------------------------" << endl;
+        
+        for (int i = 0; i < jumlahData; i++) {
+            cout << (i + 1) << ". " << daftarData[i] << endl;
+        }
+    }
+    
+    // Cari data dalam range [keyMin, keyMax], scan array yang bersebelahan
+    template<typename Function>
+    void searchRange(const KeyType& keyMin, const KeyType& keyMax,
+                     Function func) const {
+        for (int i = posisiBawah(keyMin); i < jumlahData; i++) {
+            if (daftarKey[i] > keyMax) break;
+            func(daftarData[i]);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,288 @@
+#ifndef KALENDER_KAMAR_H
+#define KALENDER_KAMAR_H
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include "TabelHash.h"
+#include "PengelolaFile.h"
+using namespace std;
+
+// ============================================================================
+// KALENDER KAMAR - OKUPANSI PER MALAM (BITSET PER KAMAR)
+// ============================================================================
+// Digunakan oleh: ManajemenKamar (pemilik), SistemPembayaran (pengisi),
+//                 KeranjangBelanja (cek bentrok saat tambah ke keranjang)
+// Setiap kamar punya satu baris bit, 1 bit = 1 malam (1 = sudah dipesan)
+// - Semua baris ada di satu array (kamar x word), lebar sama untuk semua kamar
+// - Rentang [checkIn, checkOut): malam check-out tidak ikut terisi
+// - Cek rentang cukup AND/OR beberapa word 64-bit per kamar, sehingga
+//   mencari kamar kosong untuk satu rentang = O(kamar x word)
+// - Jangkauan tanggal melebar otomatis (kelipatan 64 hari) saat ditandai,
+//   tanggal di luar jangkauan selalu dianggap kosong
+// ============================================================================
+
+class KalenderKamar {
+private:
+    static const int BIT_PER_WORD = 64;
+    static const int SLOT_AWAL = 16;
+    
+    TabelHash<int> indexSlot;   // Nomor kamar -> slot (baris)
+    string* nomorSlot;          // Slot -> nomor kamar ("" = slot kamar dihapus)
+    uint64_t* bitMalam;         // kapasitasSlot x jumlahWord
+    int jumlahSlot;
+    int kapasitasSlot;
+    int hariAwal;               // Hari pertama jangkauan (kelipatan 64)
+    int jumlahWord;             // Word per kamar
+    
+    // Helper: Pembagian ke bawah (hari bisa negatif sebelum 01/01/2000)
+    static int bagiBawah(int a, int b) {
+        return (a >= 0) ? a / b : -((-a + b - 1) / b);
+    }
+    
+    // Helper: Jalankan func(indexWord, mask) untuk setiap word yang
+    // mencakup rentang hari [mulai, selesai) yang sudah dipotong ke jangkauan
+    template<typename Function>
+    bool untukSetiapWord(int mulai, int selesai, Function func) const {
+        if (mulai < hariAwal) mulai = hariAwal;
+        if (selesai > hariAwal + jumlahWord * BIT_PER_WORD) {
+            selesai = hariAwal + jumlahWord * BIT_PER_WORD;
+        }
+        
+        for (int bit = mulai - hariAwal; bit < selesai - hariAwal; ) {
+            int word = bit / BIT_PER_WORD;
+            int awalBit = bit % BIT_PER_WORD;
+            int akhirBit = selesai - hariAwal - word * BIT_PER_WORD;
+            if (akhirBit > BIT_PER_WORD) akhirBit = BIT_PER_WORD;
+            
+            uint64_t mask = (akhirBit - awalBit == BIT_PER_WORD)
+                          ? ~0ULL
+                          : (((1ULL << (akhirBit - awalBit)) - 1) << awalBit);
+            if (!func(word, mask)) return false;
+            
+            bit = (word + 1) * BIT_PER_WORD;
+        }
+        return true;
+    }
+    
+    // Helper: Alokasi ulang array bit (slot & jangkauan hari baru)
+    void aturUlang(int kapasitasBaru, int hariAwalBaru, int jumlahWordBaru) {
+        uint64_t* bitBaru = new uint64_t[(size_t)kapasitasBaru * jumlahWordBaru]();
+        int geser = (hariAwal - hariAwalBaru) / BIT_PER_WORD;
+        
+        for (int s = 0; s < jumlahSlot && jumlahWord > 0; s++) {
+            memcpy(bitBaru + (size_t)s * jumlahWordBaru + geser,
+                   bitMalam + (size_t)s * jumlahWord,
+                   sizeof(uint64_t) * jumlahWord);
+        }
+        
+        if (kapasitasBaru != kapasitasSlot) {
+            string* nomorBaru = new string[kapasitasBaru];
+            for (int s = 0; s < jumlahSlot; s++) {
+                nomorBaru[s].swap(nomorSlot[s]);
+            }
+            delete[] nomorSlot;
+            nomorSlot = nomorBaru;
+        }
+        
+        delete[] bitMalam;
+        bitMalam = bitBaru;
+        kapasitasSlot = kapasitasBaru;
+        hariAwal = hariAwalBaru;
+        jumlahWord = jumlahWordBaru;
+    }
+    
+    // Helper: Lebarkan jangkauan agar mencakup [mulai, selesai)
+    void pastikanJangkauan(int mulai, int selesai) {
+        int awalBaru = bagiBawah(mulai, BIT_PER_WORD) * BIT_PER_WORD;
+        int akhirBaru = (bagiBawah(selesai - 1, BIT_PER_WORD) + 1) * BIT_PER_WORD;
+        
+        if (jumlahWord > 0) {
+            int akhirLama = hariAwal + jumlahWord * BIT_PER_WORD;
+            if (awalBaru >= hariAwal && akhirBaru <= akhirLama) return;
+            
+            if (hariAwal < awalBaru) awalBaru = hariAwal;
+            if (akhirLama > akhirBaru) akhirBaru = akhirLama;
+        }
+        
+        aturUlang(kapasitasSlot, awalBaru, (akhirBaru - awalBaru) / BIT_PER_WORD);
+    }
+    
+    // Helper: Baris bit milik slot
+    uint64_t* baris(int slot) {
+        return bitMalam + (size_t)slot * jumlahWord;
+    }
+    
+    const uint64_t* baris(int slot) const {
+        return bitMalam + (size_t)slot * jumlahWord;
+    }
+    
+    // Helper: Cek semua malam [mulai, selesai) di slot masih kosong
+    bool slotKosong(int slot, int mulai, int selesai) const {
+        const uint64_t* b = baris(slot);
+        return untukSetiapWord(mulai, selesai, [&](int word, uint64_t mask) {
+            return (b[word] & mask) == 0;
+        });
+    }
+    
+    // Helper: Isi malam [mulai, selesai) di slot (jangkauan dilebarkan dulu)
+    void isiSlot(int slot, int mulai, int selesai) {
+        pastikanJangkauan(mulai, selesai);
+        
+        uint64_t* b = baris(slot);
+        untukSetiapWord(mulai, selesai, [&](int word, uint64_t mask) {
+            b[word] |= mask;
+            return true;
+        });
+    }
+    
+    // Helper: Slot kamar, -1 jika belum terdaftar
+    int cariSlot(const string& nomor) const {
+        const int* slot = indexSlot.search(nomor);
+        return (slot != nullptr) ? *slot : -1;
+    }
+
+public:
+    // Constructor
+    KalenderKamar()
+        : nomorSlot(nullptr), bitMalam(nullptr), jumlahSlot(0),
+          kapasitasSlot(0), hariAwal(0), jumlahWord(0) {}
+    
+    // Destructor
+    ~KalenderKamar() {
+        delete[] nomorSlot;
+        delete[] bitMalam;
+    }
+    
+    // Kalender dimiliki oleh ManajemenKamar, tidak boleh di-copy
+    KalenderKamar(const KalenderKamar&) = delete;
+    KalenderKamar& operator=(const KalenderKamar&) = delete;
+    
+    // Konversi DD/MM/YYYY ke nomor hari sejak 01/01/2000, false jika tidak valid
+    static bool tanggalKeHari(const string& tanggal, int& hari) {
+        if (tanggal.length() != 10 || tanggal[2] != '/' || tanggal[5] != '/') return false;
+        
+        const char* data = tanggal.data();
+        int d, m, y;
+        if (!PengelolaFile::parseInt(PotonganString(data, 2), d) ||
+            !PengelolaFile::parseInt(PotonganString(data + 3, 2), m) ||
+            !PengelolaFile::parseInt(PotonganString(data + 6, 4), y)) {
+            return false;
+        }
+        
+        static const int HARI_PER_BULAN[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        bool kabisat = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+        if (y < 1900 || y > 2199 || m < 1 || m > 12 || d < 1 ||
+            d > HARI_PER_BULAN[m - 1] + ((m == 2 && kabisat) ? 1 : 0)) {
+            return false;
+        }
+        
+        // Hari sejak 01/03/0000 (tahun dimulai Maret agar kabisat di akhir)
+        if (m <= 2) y--;
+        int era = y / 400;
+        int tahunEra = y - era * 400;
+        int hariTahun = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+        int hariEra = tahunEra * 365 + tahunEra / 4 - tahunEra / 100 + hariTahun;
+        
+        hari = era * 146097 + hariEra - 730425; // 730425 = 01/01/2000
+        return true;
+    }
+    
+    // Konversi rentang check-in/check-out, false jika tidak valid atau
+    // check-out tidak setelah check-in
+    static bool parseRentang(const string& checkIn, const string& checkOut,
+                             int& mulai, int& selesai) {
+        return tanggalKeHari(checkIn, mulai) && tanggalKeHari(checkOut, selesai) &&
+               selesai > mulai;
+    }
+    
+    // Daftarkan kamar (tidak berubah jika sudah terdaftar)
+    void daftarkanKamar(const string& nomor) {
+        if (cariSlot(nomor) >= 0) return;
+        
+        if (jumlahSlot >= kapasitasSlot) {
+            aturUlang(kapasitasSlot == 0 ? SLOT_AWAL : kapasitasSlot * 2, hariAwal, jumlahWord);
+        }
+        
+        nomorSlot[jumlahSlot] = nomor;
+        indexSlot.insert(jumlahSlot, nomor);
+        jumlahSlot++;
+    }
+    
+    // Hapus kamar dari kalender (slot dikosongkan, tidak dipakai ulang)
+    void hapusKamar(const string& nomor) {
+        int slot = cariSlot(nomor);
+        if (slot < 0) return;
+        
+        memset(baris(slot), 0, sizeof(uint64_t) * jumlahWord);
+        nomorSlot[slot].clear();
+        indexSlot.hapus(nomor);
+    }
+    
+    // Cek kamar kosong di semua malam [mulai, selesai)
+    bool isKosong(const string& nomor, int mulai, int selesai) const {
+        int slot = cariSlot(nomor);
+        return slot < 0 || slotKosong(slot, mulai, selesai);
+    }
+    
+    // Tandai malam [mulai, selesai) terisi jika semuanya masih kosong
+    // false (tidak ada yang berubah) jika bentrok atau kamar tidak terdaftar
+    bool pesan(const string& nomor, int mulai, int selesai) {
+        int slot = cariSlot(nomor);
+        if (slot < 0 || selesai <= mulai) return false;
+        
+        if (!slotKosong(slot, mulai, selesai)) return false;
+        
+        isiSlot(slot, mulai, selesai);
+        return true;
+    }
+    
+    // Tandai terisi tanpa cek bentrok (untuk data lama dari file)
+    void tandai(const string& nomor, int mulai, int selesai) {
+        int slot = cariSlot(nomor);
+        if (slot < 0 || selesai <= mulai) return;
+        
+        isiSlot(slot, mulai, selesai);
+    }
+    
+    // Kosongkan kembali malam [mulai, selesai) (booking dibatalkan)
+    void lepas(const string& nomor, int mulai, int selesai) {
+        int slot = cariSlot(nomor);
+        if (slot < 0) return;
+        
+        uint64_t* b = baris(slot);
+        untukSetiapWord(mulai, selesai, [&](int word, uint64_t mask) {
+            b[word] &= ~mask;
+            return true;
+        });
+    }
+    
+    // Panggil func(nomorKamar) untuk setiap kamar yang kosong di semua
+    // malam [mulai, selesai). Return jumlah kamar kosong
+    template<typename Function>
+    int iterasiKamarKosong(int mulai, int selesai, Function func) const {
+        int jumlah = 0;
+        for (int s = 0; s < jumlahSlot; s++) {
+            if (nomorSlot[s].empty()) continue;
+            
+            if (slotKosong(s, mulai, selesai)) {
+                jumlah++;
+                func(nomorSlot[s]);
+            }
+        }
+        return jumlah;
+    }
+    
+    // Kosongkan semua okupansi (kamar tetap terdaftar)
+    void clear() {
+        if (bitMalam != nullptr) {
+            memset(bitMalam, 0, sizeof(uint64_t) * (size_t)kapasitasSlot * jumlahWord);
+        }
+    }
+    
+    // Getter
+    int getJumlahKamar() const { return indexSlot.ukuran(); }
+    int getJumlahHari() const { return jumlahWord * BIT_PER_WORD; }
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "PengelolaFile.h"
 using namespace std;
 
@@ -34,39 +35,47 @@ protected:
     string nomorKamar;      // Contoh: K101, K201
     TipeKamar tipe;
     StatusKamar status;
-    double hargaPerMalam;
+    Rupiah hargaPerMalam;
     int lantai;
     int kapasitasOrang;
     bool adaBalkon;
     bool pemandanganLaut;
+    bool perluDisimpan;     // Dirty flag: berubah sejak terakhir ditulis ke file
     
 public:
     // Constructor
-    Kamar(const string& _nomor, TipeKamar _tipe, double _harga,
+    Kamar(string _nomor, TipeKamar _tipe, const Rupiah& _harga,
           int _lantai, int _kapasitas, bool _balkon = false, 
           bool _pemandangan = false)
-        : nomorKamar(_nomor), tipe(_tipe), status(StatusKamar::TERSEDIA),
+        : nomorKamar(std::move(_nomor)), tipe(_tipe), status(StatusKamar::TERSEDIA),
           hargaPerMalam(_harga), lantai(_lantai), kapasitasOrang(_kapasitas),
-          adaBalkon(_balkon), pemandanganLaut(_pemandangan) {}
+          adaBalkon(_balkon), pemandanganLaut(_pemandangan), perluDisimpan(false) {}
     
     virtual ~Kamar() {}
     
     // Getter
-    string getNomorKamar() const { return nomorKamar; }
+    const string& getNomorKamar() const { return nomorKamar; }
     TipeKamar getTipe() const { return tipe; }
     StatusKamar getStatus() const { return status; }
-    double getHargaPerMalam() const { return hargaPerMalam; }
+    Rupiah getHargaPerMalam() const { return hargaPerMalam; }
     int getLantai() const { return lantai; }
     int getKapasitasOrang() const { return kapasitasOrang; }
     bool hasBalkon() const { return adaBalkon; }
     bool hasPemandanganLaut() const { return pemandanganLaut; }
+    bool isPerluDisimpan() const { return perluDisimpan; }
     
     // Setter
     void setStatus(StatusKamar _status) { status = _status; }
-    void setHargaPerMalam(double _harga) { hargaPerMalam = _harga; }
+    void setHargaPerMalam(const Rupiah& _harga) { hargaPerMalam = _harga; }
+    void setPerluDisimpan(bool _perlu) { perluDisimpan = _perlu; }
     
     // Helper: Convert tipe ke string
     string getTipeString() const {
+        return tipeKeString(tipe);
+    }
+    
+    // Helper: Static function - TipeKamar ke string
+    static string tipeKeString(TipeKamar tipe) {
         switch (tipe) {
             case TipeKamar::STANDARD: return "STANDARD";
             case TipeKamar::DELUXE: return "DELUXE";
@@ -140,7 +149,7 @@ public:
         fields[0] = getTipeString();
         fields[1] = nomorKamar;
         fields[2] = getStatusString();
-        fields[3] = to_string(static_cast<long long>(hargaPerMalam));
+        fields[3] = hargaPerMalam.toString();
         fields[4] = to_string(lantai);
         fields[5] = to_string(kapasitasOrang);
         fields[6] = (adaBalkon ? "1" : "0");
@@ -156,8 +165,8 @@ public:
 // ============================================================================
 class KamarStandard : public Kamar {
 public:
-    KamarStandard(const string& _nomor, int _lantai = 1)
-        : Kamar(_nomor, TipeKamar::STANDARD, 500000.0, _lantai, 2, false, false) {}
+    KamarStandard(string _nomor, int _lantai = 1)
+        : Kamar(std::move(_nomor), TipeKamar::STANDARD, Rupiah::dariRupiah(500000), _lantai, 2, false, false) {}
     
     string getFasilitas() const override {
         return "TV LED 32\", AC, Wi-Fi gratis, Kamar mandi dalam, Air panas";
@@ -169,8 +178,8 @@ public:
 // ============================================================================
 class KamarDeluxe : public Kamar {
 public:
-    KamarDeluxe(const string& _nomor, int _lantai = 2, bool _balkon = true)
-        : Kamar(_nomor, TipeKamar::DELUXE, 1000000.0, _lantai, 2, _balkon, false) {}
+    KamarDeluxe(string _nomor, int _lantai = 2, bool _balkon = true)
+        : Kamar(std::move(_nomor), TipeKamar::DELUXE, Rupiah::dariRupiah(1000000), _lantai, 2, _balkon, false) {}
     
     string getFasilitas() const override {
         return "TV LED 43\", AC, Wi-Fi gratis, Kamar mandi dalam, Air panas, "
@@ -183,8 +192,8 @@ public:
 // ============================================================================
 class KamarSuite : public Kamar {
 public:
-    KamarSuite(const string& _nomor, int _lantai = 3, bool _pemandangan = true)
-        : Kamar(_nomor, TipeKamar::SUITE, 2500000.0, _lantai, 4, true, _pemandangan) {}
+    KamarSuite(string _nomor, int _lantai = 3, bool _pemandangan = true)
+        : Kamar(std::move(_nomor), TipeKamar::SUITE, Rupiah::dariRupiah(2500000), _lantai, 4, true, _pemandangan) {}
     
     string getFasilitas() const override {
         return "TV LED 55\" x2, AC, Wi-Fi premium, Kamar mandi luas + bathtub, "
@@ -198,8 +207,8 @@ public:
 // ============================================================================
 class KamarPresidential : public Kamar {
 public:
-    KamarPresidential(const string& _nomor, int _lantai = 5)
-        : Kamar(_nomor, TipeKamar::PRESIDENTIAL, 5000000.0, _lantai, 6, true, true) {}
+    KamarPresidential(string _nomor, int _lantai = 5)
+        : Kamar(std::move(_nomor), TipeKamar::PRESIDENTIAL, Rupiah::dariRupiah(5000000), _lantai, 6, true, true) {}
     
     string getFasilitas() const override {
         return "TV LED 65\" x3, AC, Wi-Fi premium, 2 Kamar tidur master, "
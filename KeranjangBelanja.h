@@ -3,10 +3,12 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "CircularLinkedList.h"
 #include "Transaksi.h"
 #include "Kamar.h"
 #include "Layanan.h"
+#include "KalenderKamar.h"
 #include "PengelolaFile.h"
 using namespace std;
 
@@ -14,6 +16,8 @@ using namespace std;
 // KERANJANG BELANJA - MULTI-ITEM BOOKING CART
 // ============================================================================
 // Fitur utama Fase 2: Customer bisa pilih banyak kamar + layanan sebelum checkout
+// Kamar dicek terhadap kalender okupansi (jika ada) dan item kamar lain di
+// keranjang, sehingga rentang tanggal yang bentrok ditolak sebelum checkout
 // ============================================================================
 
 class KeranjangBelanja {
@@ -21,11 +25,28 @@ private:
     string idPelanggan;
     string namaPelanggan;
     CircularLinkedList<ItemBooking*> daftarItem;
-    double totalHarga;
+    Rupiah totalHarga;
+    const KalenderKamar* kalender;    // Okupansi kamar (opsional)
+    
+    // Helper: Cek kamar sudah ada di keranjang dengan malam yang tumpang tindih
+    bool bentrokDiKeranjang(const string& nomorKamar, int mulai, int selesai) {
+        bool bentrok = false;
+        daftarItem.iterasi([&](ItemBooking* item) {
+            if (bentrok || item->getJenis() != JenisItem::KAMAR ||
+                item->getIdItem() != nomorKamar) return;
+            
+            int mulaiLain, selesaiLain;
+            if (KalenderKamar::parseRentang(item->getTanggalMulai(), item->getTanggalSelesai(),
+                                            mulaiLain, selesaiLain)) {
+                bentrok = mulai < selesaiLain && mulaiLain < selesai;
+            }
+        });
+        return bentrok;
+    }
     
     // Helper: Hitung total
     void hitungTotal() {
-        totalHarga = 0.0;
+        totalHarga = Rupiah();
         daftarItem.iterasi([&](ItemBooking* item) {
             totalHarga += item->getSubtotal();
         });
@@ -33,8 +54,10 @@ private:
 
 public:
     // Constructor
-    KeranjangBelanja(const string& _idPelanggan, const string& _namaPelanggan)
-        : idPelanggan(_idPelanggan), namaPelanggan(_namaPelanggan), totalHarga(0.0) {}
+    KeranjangBelanja(const string& _idPelanggan, const string& _namaPelanggan,
+                     const KalenderKamar* _kalender = nullptr)
+        : idPelanggan(_idPelanggan), namaPelanggan(_namaPelanggan), totalHarga(),
+          kalender(_kalender) {}
     
     // Destructor
     ~KeranjangBelanja() {
@@ -43,7 +66,8 @@ public:
     }
     
     // Tambah kamar ke keranjang
-    bool tambahKamar(Kamar* kamar, int jumlahMalam, 
+    // Jumlah malam dihitung dari rentang tanggal (check-out - check-in)
+    bool tambahKamar(Kamar* kamar,
                      const string& tanggalCheckIn, const string& tanggalCheckOut,
                      const string& keterangan = "") {
         
@@ -52,13 +76,24 @@ public:
             return false;
         }
         
-        if (kamar->getStatus() != StatusKamar::TERSEDIA) {
+        // Status TERISI hanya berlaku hari ini, ketersediaan per tanggal
+        // dicek lewat kalender
+        if (kamar->getStatus() == StatusKamar::PERBAIKAN) {
             cout << "[ERROR] Kamar " << kamar->getNomorKamar() << " tidak tersedia!" << endl;
             return false;
         }
         
-        if (jumlahMalam < 1) {
-            cout << "[ERROR] Jumlah malam minimal 1!" << endl;
+        int mulai, selesai;
+        if (!KalenderKamar::parseRentang(tanggalCheckIn, tanggalCheckOut, mulai, selesai)) {
+            cout << "[ERROR] Tanggal tidak valid! Format DD/MM/YYYY, check-out setelah check-in." << endl;
+            return false;
+        }
+        int jumlahMalam = selesai - mulai;
+        
+        if ((kalender != nullptr && !kalender->isKosong(kamar->getNomorKamar(), mulai, selesai)) ||
+            bentrokDiKeranjang(kamar->getNomorKamar(), mulai, selesai)) {
+            cout << "[ERROR] Kamar " << kamar->getNomorKamar() 
+                 << " sudah dipesan pada tanggal tersebut!" << endl;
             return false;
         }
         
@@ -162,9 +197,9 @@ public:
             delete item;
         });
         
-        // Reset
-        daftarItem = CircularLinkedList<ItemBooking*>();
-        totalHarga = 0.0;
+        // Reset (node list dikembalikan ke pool)
+        daftarItem.clear();
+        totalHarga = Rupiah();
         
         cout << "[INFO] Keranjang telah dikosongkan" << endl;
     }
@@ -180,7 +215,7 @@ public:
     }
     
     // Dapatkan total harga (sebelum pajak)
-    double getTotalHarga() const {
+    Rupiah getTotalHarga() const {
         return totalHarga;
     }
     
@@ -236,50 +271,19 @@ public:
     }
     
     // Checkout - Convert keranjang menjadi transaksi
+    // ID transaksi belum diisi, diberikan SistemPembayaran::prosesPembayaran
+    // setelah kamar berhasil dipesan agar percobaan gagal tidak memakai ID
     Transaksi* checkout(const string& tanggalTransaksi) {
         if (daftarItem.kosong()) {
             cout << "[ERROR] Keranjang kosong! Tidak bisa checkout." << endl;
             return nullptr;
         }
         
-        // Generate ID transaksi
-        static int counterTransaksi = 1;
-        string idTransaksi = "T" + PengelolaFile::generateID("", counterTransaksi++);
-        
         // Buat transaksi baru
-        Transaksi* transaksi = new Transaksi(idTransaksi, idPelanggan, 
+        Transaksi* transaksi = new Transaksi("", idPelanggan, 
                                              namaPelanggan, tanggalTransaksi);
         
-        // Copy semua item ke transaksi (deep copy)
-        daftarItem.iterasi([&](ItemBooking* item) {
-            // Buat copy item
-            ItemBooking* itemCopy = nullptr;
-            
-            if (item->getJenis() == JenisItem::KAMAR) {
-                itemCopy = ItemBooking::buatBookingKamar(
-                    item->getIdItem(),
-                    item->getNamaItem(),
-                    item->getHargaSatuan(),
-                    item->getKuantitas(),
-                    item->getTanggalMulai(),
-                    item->getTanggalSelesai(),
-                    item->getKeterangan()
-                );
-            } else {
-                itemCopy = ItemBooking::buatBookingLayanan(
-                    item->getIdItem(),
-                    item->getNamaItem(),
-                    item->getHargaSatuan(),
-                    item->getKuantitas(),
-                    item->getTanggalMulai(),
-                    item->getKeterangan()
-                );
-            }
-            
-            transaksi->tambahItem(itemCopy);
-        });
-        
-        // Set tanggal check-in/out dari item pertama (jika ada kamar)
+        // Tanggal check-in/out dari item pertama (jika ada kamar)
         ItemBooking** itemPertamaPtr = daftarItem.dapatkanByIndex(0);
         if (itemPertamaPtr && *itemPertamaPtr && (*itemPertamaPtr)->getJenis() == JenisItem::KAMAR) {
             ItemBooking* itemPertama = *itemPertamaPtr;
@@ -287,14 +291,33 @@ public:
             transaksi->setTanggalCheckOut(itemPertama->getTanggalSelesai());
         }
         
+        // Pindahkan semua item ke transaksi (satu kali alokasi, isi item
+        // di-move). Jika pembayaran gagal, pemanggil mengembalikan item lewat
+        // batalCheckout; jika berhasil, keranjang dikosongkan pemanggil
+        transaksi->reservasiItem(daftarItem.ukuran());
+        daftarItem.iterasi([&](ItemBooking* item) {
+            transaksi->tambahItem(std::move(*item));
+        });
+        
         cout << "\n[SUKSES] Transaksi berhasil dibuat!" << endl;
-        cout << "ID Transaksi: " << idTransaksi << endl;
-        cout << "Total Item  : " << daftarItem.ukuran() << endl;
+        cout << "Total Item  : " << transaksi->getJumlahItem() << endl;
         cout << "Total Bayar : " << PengelolaFile::formatRupiahLengkap(transaksi->getTotalAkhir()) << endl;
         
         return transaksi;
     }
     
+    // Checkout batal (pembayaran gagal) - item di-move kembali ke keranjang
+    // dengan urutan yang sama, lalu transaksi dihapus
+    void batalCheckout(Transaksi* transaksi) {
+        if (transaksi == nullptr) return;
+        
+        int index = 0;
+        daftarItem.iterasi([&](ItemBooking* item) {
+            *item = transaksi->lepasItem(index++);
+        });
+        delete transaksi;
+    }
+    
     // Edit kuantitas item
     bool editKuantitas(int index, int kuantitasBaru) {
         if (index < 1 || index > daftarItem.ukuran()) {
@@ -307,6 +330,13 @@ public:
         
         ItemBooking* item = *itemPtr;
         
+        // Durasi kamar mengikuti tanggal yang sudah dicek ke kalender
+        if (item->getJenis() == JenisItem::KAMAR) {
+            cout << "[ERROR] Durasi kamar mengikuti tanggal check-in/check-out. "
+                 << "Hapus item lalu tambahkan ulang dengan tanggal baru." << endl;
+            return false;
+        }
+        
         if (kuantitasBaru < 1) {
             cout << "[ERROR] Kuantitas minimal 1!" << endl;
             return false;
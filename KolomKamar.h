@@ -0,0 +1,357 @@
+#ifndef KOLOM_KAMAR_H
+#define KOLOM_KAMAR_H
+
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include "Kamar.h"
+
+// Histogram hitung ulang (hitungRingkasan) memakai AVX2 jika compiler
+// menargetkan AVX2 (-mavx2 / -march=native), selain itu loop skalar biasa.
+// Layar statistik memakai ringkasan incremental IndeksKamar, hitung ulang
+// hanya dipakai pemeriksaan konsistensi (PERIKSA_STATISTIK)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define KOLOM_KAMAR_AVX2
+#endif
+
+using namespace std;
+
+// ============================================================================
+// KOLOM KAMAR - SALINAN TABEL KAMAR PER KOLOM (STRUCTURE OF ARRAYS)
+// ============================================================================
+// Digunakan oleh: IndeksKamar (nomor slot sama), ManajemenKamar (statistik)
+// Objek Kamar tersebar di heap dan dicapai lewat pointer; untuk filter &
+// hitungan cukup atribut kecilnya saja, disalin ke array bersebelahan:
+//   status, tipe, flag (uint8) | lantai, kapasitas (int32) | harga (int64 sen)
+// - Loop predikat & hitungan tanpa cabang (AND hasil perbandingan), sehingga
+//   bisa divektorisasi compiler dan tidak menyentuh string/pointer
+// - Slot kamar yang dihapus: flag HIDUP dimatikan (slot tidak dipakai ulang)
+// KriteriaKamar (kriteria pencarian kamar) & RingkasanKamar (statistik)
+// juga didefinisikan di sini
+// ============================================================================
+
+// Kriteria pencarian kamar (kriteria yang tidak dipakai = bebas)
+struct KriteriaKamar {
+    bool pakaiTipe;
+    TipeKamar tipe;
+    bool pakaiStatus;
+    StatusKamar status;
+    bool pakaiLantai;
+    int lantaiMin;
+    int lantaiMaks;
+    int kapasitasMin;           // 0 = bebas
+    bool pakaiHarga;
+    Rupiah hargaMin;
+    Rupiah hargaMaks;
+    bool harusBalkon;
+    bool harusPemandanganLaut;
+    
+    KriteriaKamar()
+        : pakaiTipe(false), tipe(TipeKamar::STANDARD),
+          pakaiStatus(false), status(StatusKamar::TERSEDIA),
+          pakaiLantai(false), lantaiMin(0), lantaiMaks(0), kapasitasMin(0),
+          pakaiHarga(false), hargaMin(), hargaMaks(),
+          harusBalkon(false), harusPemandanganLaut(false) {}
+    
+    // Cek satu kamar terhadap semua kriteria
+    bool cocok(const Kamar& k) const {
+        if (pakaiTipe && k.getTipe() != tipe) return false;
+        if (pakaiStatus && k.getStatus() != status) return false;
+        if (pakaiLantai && (k.getLantai() < lantaiMin || k.getLantai() > lantaiMaks)) return false;
+        if (k.getKapasitasOrang() < kapasitasMin) return false;
+        if (pakaiHarga && (k.getHargaPerMalam() < hargaMin || k.getHargaPerMalam() > hargaMaks)) return false;
+        if (harusBalkon && !k.hasBalkon()) return false;
+        if (harusPemandanganLaut && !k.hasPemandanganLaut()) return false;
+        return true;
+    }
+};
+
+// Hasil hitungRingkasan: jumlah kamar per status, tipe & lantai
+struct RingkasanKamar {
+    static const int BATAS_LANTAI = 128;    // Lantai >= ini digabung ke baris terakhir
+    
+    int total;
+    int perStatus[4];                       // index = StatusKamar
+    int perTipe[4];                         // index = TipeKamar
+    int terisiPerTipe[4];
+    int perLantai[BATAS_LANTAI];            // Lantai < 0 dihitung sebagai lantai 0
+    int terisiPerLantai[BATAS_LANTAI];
+};
+
+class KolomKamar {
+public:
+    static const uint8_t FLAG_HIDUP = 1;
+    static const uint8_t FLAG_BALKON = 2;
+    static const uint8_t FLAG_LAUT = 4;
+    
+    // Predikat KriteriaKamar dalam bentuk batas per kolom
+    // (kriteria yang tidak dipakai diganti batas yang selalu lolos)
+    struct Predikat {
+        uint8_t flagWajib;
+        bool semuaTipe;
+        uint8_t tipe;
+        bool semuaStatus;
+        uint8_t status;
+        int32_t lantaiMin, lantaiMaks;
+        int32_t kapasitasMin;
+        int64_t hargaMin, hargaMaks;
+        
+        explicit Predikat(const KriteriaKamar& k)
+            : flagWajib(FLAG_HIDUP | (k.harusBalkon ? FLAG_BALKON : 0) |
+                        (k.harusPemandanganLaut ? FLAG_LAUT : 0)),
+              semuaTipe(!k.pakaiTipe), tipe(static_cast<uint8_t>(k.tipe)),
+              semuaStatus(!k.pakaiStatus), status(static_cast<uint8_t>(k.status)),
+              lantaiMin(k.pakaiLantai ? k.lantaiMin : INT32_MIN),
+              lantaiMaks(k.pakaiLantai ? k.lantaiMaks : INT32_MAX),
+              kapasitasMin(k.kapasitasMin),
+              hargaMin(k.pakaiHarga ? k.hargaMin.getSen() : INT64_MIN),
+              hargaMaks(k.pakaiHarga ? k.hargaMaks.getSen() : INT64_MAX) {}
+    };
+
+private:
+    uint8_t* status;
+    uint8_t* tipe;
+    uint8_t* flag;
+    int32_t* lantai;
+    int32_t* kapasitas;
+    int64_t* harga;
+    int jumlahSlot;
+    int kapasitasSlot;
+    
+    // Helper: Cek satu slot (tanpa cabang, dipakai di dalam loop)
+    bool lolos(const Predikat& p, int i) const {
+        return ((flag[i] & p.flagWajib) == p.flagWajib) &
+               ((tipe[i] == p.tipe) | p.semuaTipe) &
+               ((status[i] == p.status) | p.semuaStatus) &
+               (lantai[i] >= p.lantaiMin) & (lantai[i] <= p.lantaiMaks) &
+               (kapasitas[i] >= p.kapasitasMin) &
+               (harga[i] >= p.hargaMin) & (harga[i] <= p.hargaMaks);
+    }
+    
+    // Helper: Kunci histogram tipe/status, 16..31 untuk slot mati
+    int kunciSlot(int i) const {
+        int mati = (flag[i] & FLAG_HIDUP) ^ 1;
+        return (mati << 4) | ((tipe[i] & 3) << 2) | (status[i] & 3);
+    }
+    
+    // Helper: Kunci histogram lantai (lantai * 2 + terisi), slot mati
+    // diarahkan ke paruh kedua bin (diabaikan)
+    int kunciLantai(int i) const {
+        int mati = (flag[i] & FLAG_HIDUP) ^ 1;
+        int l = lantai[i];
+        l = (l < 0) ? 0 : ((l >= RingkasanKamar::BATAS_LANTAI) ? RingkasanKamar::BATAS_LANTAI - 1 : l);
+        int terisi = (status[i] == static_cast<uint8_t>(StatusKamar::TERISI));
+        return ((l << 1) | terisi) + mati * 2 * RingkasanKamar::BATAS_LANTAI;
+    }
+
+#ifdef KOLOM_KAMAR_AVX2
+    // Helper: Histogram 32 slot sekaligus. Kunci dihitung di register, lalu
+    // dibandingkan dengan 16 kunci; hasil (-1/0) dikurangkan ke 16 akumulator
+    // byte yang dijumlahkan (SAD) sebelum bisa overflow (255 blok).
+    // Lantai tetap dihitung skalar di blok yang sama. Return jumlah slot
+    // yang sudah diproses (kelipatan 32)
+    int histogramAvx2(int binKunci[32], int binLantai[]) const {
+        const __m256i nol = _mm256_setzero_si256();
+        const __m256i satu = _mm256_set1_epi8(1);
+        const __m256i tiga = _mm256_set1_epi8(3);
+        
+        __m256i akumulator[16];
+        __m256i total[16];
+        for (int k = 0; k < 16; k++) {
+            akumulator[k] = nol;
+            total[k] = nol;
+        }
+        
+        int i = 0;
+        int blok = 0;
+        for (; i + 32 <= jumlahSlot; i += 32) {
+            __m256i st = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(status + i)), tiga);
+            __m256i tp = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(tipe + i)), tiga);
+            __m256i mati = _mm256_andnot_si256(_mm256_loadu_si256((const __m256i*)(flag + i)), satu);
+            
+            // Nilai per byte <= 3 / <= 1, geser 16-bit tidak meluber ke byte sebelah
+            __m256i kunci = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(tp, 2), st),
+                                            _mm256_slli_epi16(mati, 4));
+            for (int k = 0; k < 16; k++) {
+                akumulator[k] = _mm256_sub_epi8(akumulator[k],
+                                                _mm256_cmpeq_epi8(kunci, _mm256_set1_epi8((char)k)));
+            }
+            
+            for (int j = i; j < i + 32; j++) {
+                binLantai[kunciLantai(j)]++;
+            }
+            
+            if (++blok == 255) {
+                for (int k = 0; k < 16; k++) {
+                    total[k] = _mm256_add_epi64(total[k], _mm256_sad_epu8(akumulator[k], nol));
+                    akumulator[k] = nol;
+                }
+                blok = 0;
+            }
+        }
+        
+        for (int k = 0; k < 16; k++) {
+            total[k] = _mm256_add_epi64(total[k], _mm256_sad_epu8(akumulator[k], nol));
+            int64_t lajur[4];
+            _mm256_storeu_si256((__m256i*)lajur, total[k]);
+            binKunci[k] += (int)(lajur[0] + lajur[1] + lajur[2] + lajur[3]);
+        }
+        return i;
+    }
+#endif
+    
+    template<typename U>
+    static void perbesar(U*& kolom, int jumlah, int kapasitasBaru) {
+        U* baru = new U[kapasitasBaru];
+        if (jumlah > 0) memcpy(baru, kolom, sizeof(U) * jumlah);
+        delete[] kolom;
+        kolom = baru;
+    }
+
+public:
+    // Constructor
+    KolomKamar()
+        : status(nullptr), tipe(nullptr), flag(nullptr), lantai(nullptr),
+          kapasitas(nullptr), harga(nullptr), jumlahSlot(0), kapasitasSlot(0) {}
+    
+    // Destructor
+    ~KolomKamar() {
+        delete[] status;
+        delete[] tipe;
+        delete[] flag;
+        delete[] lantai;
+        delete[] kapasitas;
+        delete[] harga;
+    }
+    
+    // Dimiliki oleh IndeksKamar, tidak boleh di-copy
+    KolomKamar(const KolomKamar&) = delete;
+    KolomKamar& operator=(const KolomKamar&) = delete;
+    
+    // Siapkan kapasitas untuk n slot
+    void reservasi(int n) {
+        if (n <= kapasitasSlot) return;
+        
+        perbesar(status, jumlahSlot, n);
+        perbesar(tipe, jumlahSlot, n);
+        perbesar(flag, jumlahSlot, n);
+        perbesar(lantai, jumlahSlot, n);
+        perbesar(kapasitas, jumlahSlot, n);
+        perbesar(harga, jumlahSlot, n);
+        kapasitasSlot = n;
+    }
+    
+    // Isi slot dengan atribut kamar (slot == jumlah slot: slot baru)
+    // Kapasitas harus sudah disiapkan dengan reservasi
+    void isi(int slot, const Kamar& k) {
+        status[slot] = static_cast<uint8_t>(k.getStatus());
+        tipe[slot] = static_cast<uint8_t>(k.getTipe());
+        flag[slot] = FLAG_HIDUP | (k.hasBalkon() ? FLAG_BALKON : 0) |
+                     (k.hasPemandanganLaut() ? FLAG_LAUT : 0);
+        lantai[slot] = k.getLantai();
+        kapasitas[slot] = k.getKapasitasOrang();
+        harga[slot] = k.getHargaPerMalam().getSen();
+        
+        if (slot >= jumlahSlot) jumlahSlot = slot + 1;
+    }
+    
+    void setStatus(int slot, StatusKamar _status) { status[slot] = static_cast<uint8_t>(_status); }
+    void setHarga(int slot, int64_t _harga) { harga[slot] = _harga; }
+    
+    // Matikan slot (kamar dihapus)
+    void hapus(int slot) {
+        flag[slot] = 0;
+    }
+    
+    // Kosongkan semua slot (kapasitas dipakai ulang)
+    void clear() {
+        jumlahSlot = 0;
+    }
+    
+    // Getter kolom
+    int getJumlahSlot() const { return jumlahSlot; }
+    int64_t getHarga(int slot) const { return harga[slot]; }
+    bool isHidup(int slot) const { return (flag[slot] & FLAG_HIDUP) != 0; }
+    
+    // Cek satu slot terhadap predikat (dibuat sekali per pencarian)
+    bool cocok(const Predikat& predikat, int slot) const {
+        return lolos(predikat, slot);
+    }
+    
+    // Hitung slot yang memenuhi kriteria (satu pass tanpa cabang)
+    int hitung(const KriteriaKamar& kriteria) const {
+        Predikat p(kriteria);
+        int jumlah = 0;
+        for (int i = 0; i < jumlahSlot; i++) {
+            jumlah += lolos(p, i);
+        }
+        return jumlah;
+    }
+    
+    // Panggil func(slot) untuk setiap slot yang memenuhi kriteria
+    template<typename Function>
+    int iterasiCocok(const KriteriaKamar& kriteria, Function func) const {
+        Predikat p(kriteria);
+        int jumlah = 0;
+        for (int i = 0; i < jumlahSlot; i++) {
+            if (lolos(p, i)) {
+                jumlah++;
+                func(i);
+            }
+        }
+        return jumlah;
+    }
+    
+    // Tambahkan (arah = 1) atau kurangi (arah = -1) kontribusi satu slot ke
+    // ringkasan yang dijaga incremental. Slot mati tidak dihitung
+    void catatRingkasan(RingkasanKamar& hasil, int slot, int arah) const {
+        if (!isHidup(slot)) return;
+        
+        int st = status[slot] & 3;
+        int tp = tipe[slot] & 3;
+        int l = kunciLantai(slot) >> 1;
+        int terisi = (st == static_cast<int>(StatusKamar::TERISI)) ? arah : 0;
+        
+        hasil.total += arah;
+        hasil.perStatus[st] += arah;
+        hasil.perTipe[tp] += arah;
+        hasil.terisiPerTipe[tp] += terisi;
+        hasil.perLantai[l] += arah;
+        hasil.terisiPerLantai[l] += terisi;
+    }
+    
+    // Hitung jumlah kamar per status, per tipe & per lantai (beserta yang
+    // TERISI) dalam satu pass dari nol. Tipe & status digabung jadi satu kunci
+    // 0..15 (tipe * 4 + status), slot mati diberi kunci 16..31 (diabaikan)
+    void hitungRingkasan(RingkasanKamar& hasil) const {
+        int binKunci[32] = {0};
+        int binLantai[4 * RingkasanKamar::BATAS_LANTAI] = {0};
+        
+        int i = 0;
+#ifdef KOLOM_KAMAR_AVX2
+        i = histogramAvx2(binKunci, binLantai);
+#endif
+        for (; i < jumlahSlot; i++) {
+            binKunci[kunciSlot(i)]++;
+            binLantai[kunciLantai(i)]++;
+        }
+        
+        memset(&hasil, 0, sizeof(hasil));
+        for (int t = 0; t < 4; t++) {
+            for (int st = 0; st < 4; st++) {
+                int jumlah = binKunci[t * 4 + st];
+                hasil.perStatus[st] += jumlah;
+                hasil.perTipe[t] += jumlah;
+                hasil.total += jumlah;
+            }
+            hasil.terisiPerTipe[t] = binKunci[t * 4 + static_cast<int>(StatusKamar::TERISI)];
+        }
+        for (int l = 0; l < RingkasanKamar::BATAS_LANTAI; l++) {
+            hasil.perLantai[l] = binLantai[l * 2] + binLantai[l * 2 + 1];
+            hasil.terisiPerLantai[l] = binLantai[l * 2 + 1];
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef KUBUS_PENDAPATAN_H
+#define KUBUS_PENDAPATAN_H
+
+#include <string>
+#include "Rupiah.h"
+#include "Transaksi.h"
+#include "KalenderKamar.h"
+using namespace std;
+
+// ============================================================================
+// KUBUS PENDAPATAN - REKAP HARIAN + PREFIX SUM
+// ============================================================================
+// Digunakan oleh: SistemPembayaran (pengisi), LaporanKeuangan (query range)
+// Setiap hari punya satu sel per kombinasi status x metode pembayaran berisi
+// jumlah transaksi, pendapatan, pajak + service, dan subtotal & jumlah item
+// per jenis item (kamar / layanan)
+// - Hari = tanggal transaksi sejak 01/01/2000 (KalenderKamar::tanggalKeHari)
+// - catat(t, +1 / -1) dipanggil saat transaksi masuk & saat status berubah
+// - Prefix sum per sel dihitung lazy: perubahan di hari h hanya membuat
+//   prefix setelah h kadaluarsa, dan prefix hanya dihitung ulang sampai hari
+//   yang diminta query. Transaksi baru selalu di hari terakhir sehingga
+//   hitung ulangnya hanya beberapa baris
+// - Jumlah untuk rentang hari [mulai, selesai] = kumulatif[selesai + 1] -
+//   kumulatif[mulai] per sel, O(status x metode) berapapun panjang riwayat
+// ============================================================================
+
+// Agregat transaksi dalam satu sel kubus (atau hasil query range)
+struct SelPendapatan {
+    int jumlahTransaksi;
+    int jumlahItem[2];          // index = JenisItem
+    Rupiah pendapatan;          // Total akhir
+    Rupiah pendapatanItem[2];   // Subtotal item per JenisItem (sebelum pajak)
+    Rupiah pajakDanService;     // Total akhir - subtotal item
+    Rupiah tanpaRincian;        // Total akhir transaksi yang itemnya tidak ada
+    
+    SelPendapatan()
+        : jumlahTransaksi(0), jumlahItem(), pendapatan(), pendapatanItem(),
+          pajakDanService(), tanpaRincian() {}
+    
+    SelPendapatan& operator+=(const SelPendapatan& lain) {
+        jumlahTransaksi += lain.jumlahTransaksi;
+        pendapatan += lain.pendapatan;
+        pajakDanService += lain.pajakDanService;
+        tanpaRincian += lain.tanpaRincian;
+        for (int j = 0; j < 2; j++) {
+            jumlahItem[j] += lain.jumlahItem[j];
+            pendapatanItem[j] += lain.pendapatanItem[j];
+        }
+        return *this;
+    }
+    
+    SelPendapatan& operator-=(const SelPendapatan& lain) {
+        jumlahTransaksi -= lain.jumlahTransaksi;
+        pendapatan -= lain.pendapatan;
+        pajakDanService -= lain.pajakDanService;
+        tanpaRincian -= lain.tanpaRincian;
+        for (int j = 0; j < 2; j++) {
+            jumlahItem[j] -= lain.jumlahItem[j];
+            pendapatanItem[j] -= lain.pendapatanItem[j];
+        }
+        return *this;
+    }
+};
+
+class KubusPendapatan {
+private:
+    static const int JUMLAH_STATUS = 4;     // StatusTransaksi
+    static const int JUMLAH_METODE = 4;     // MetodePembayaran
+    static const int SEL_PER_HARI = JUMLAH_STATUS * JUMLAH_METODE;
+    static const int BLOK_HARI = 64;        // Jangkauan melebar kelipatan 64 hari
+    
+    SelPendapatan* harian;      // jumlahHari x SEL_PER_HARI
+    SelPendapatan* kumulatif;   // (jumlahHari + 1) x SEL_PER_HARI, baris i = hari < i
+    int hariAwal;               // Hari pertama jangkauan (kelipatan BLOK_HARI)
+    int jumlahHari;
+    int barisSiap;              // Baris kumulatif 0..barisSiap masih valid
+    
+    // Helper: Pembagian ke bawah (hari bisa negatif sebelum 01/01/2000)
+    static int bagiBawah(int a, int b) {
+        return (a >= 0) ? a / b : -((-a + b - 1) / b);
+    }
+    
+    // Helper: Index sel dalam satu baris hari
+    static int indexSel(StatusTransaksi status, MetodePembayaran metode) {
+        return static_cast<int>(status) * JUMLAH_METODE + static_cast<int>(metode);
+    }
+    
+    // Helper: Alokasi ulang untuk jangkauan baru (data lama digeser)
+    void aturUlang(int hariAwalBaru, int jumlahHariBaru) {
+        SelPendapatan* harianBaru = new SelPendapatan[(size_t)jumlahHariBaru * SEL_PER_HARI];
+        int geser = hariAwal - hariAwalBaru;
+        for (size_t i = 0; i < (size_t)jumlahHari * SEL_PER_HARI; i++) {
+            harianBaru[(size_t)geser * SEL_PER_HARI + i] = harian[i];
+        }
+        
+        delete[] harian;
+        delete[] kumulatif;
+        harian = harianBaru;
+        kumulatif = new SelPendapatan[(size_t)(jumlahHariBaru + 1) * SEL_PER_HARI];
+        hariAwal = hariAwalBaru;
+        jumlahHari = jumlahHariBaru;
+        barisSiap = 0; // Baris 0 selalu nol
+    }
+    
+    // Helper: Lebarkan jangkauan agar mencakup hari
+    // Melebar minimal setengah jangkauan lama agar load data urut tanggal
+    // tidak mengalokasi ulang setiap blok
+    void pastikanJangkauan(int hari) {
+        if (jumlahHari > 0 && hari >= hariAwal && hari < hariAwal + jumlahHari) return;
+        
+        int blok = bagiBawah(hari, BLOK_HARI) * BLOK_HARI;
+        if (jumlahHari == 0) {
+            aturUlang(blok, BLOK_HARI);
+            return;
+        }
+        
+        int tambahan = ((jumlahHari / 2 + BLOK_HARI - 1) / BLOK_HARI) * BLOK_HARI;
+        int awalBaru = hariAwal;
+        int akhirBaru = hariAwal + jumlahHari;
+        if (hari < hariAwal) {
+            awalBaru = blok;
+            if (awalBaru > hariAwal - tambahan) awalBaru = hariAwal - tambahan;
+        } else {
+            akhirBaru = blok + BLOK_HARI;
+            if (akhirBaru < hariAwal + jumlahHari + tambahan) akhirBaru = hariAwal + jumlahHari + tambahan;
+        }
+        
+        aturUlang(awalBaru, akhirBaru - awalBaru);
+    }
+    
+    // Helper: Pastikan baris kumulatif 0..baris valid
+    void siapkanKumulatif(int baris) {
+        for (; barisSiap < baris; barisSiap++) {
+            const SelPendapatan* sebelum = kumulatif + (size_t)barisSiap * SEL_PER_HARI;
+            const SelPendapatan* hari = harian + (size_t)barisSiap * SEL_PER_HARI;
+            SelPendapatan* hasil = kumulatif + (size_t)(barisSiap + 1) * SEL_PER_HARI;
+            
+            for (int s = 0; s < SEL_PER_HARI; s++) {
+                hasil[s] = sebelum[s];
+                hasil[s] += hari[s];
+            }
+        }
+    }
+
+public:
+    // Constructor
+    KubusPendapatan()
+        : harian(nullptr), kumulatif(nullptr), hariAwal(0), jumlahHari(0), barisSiap(0) {}
+    
+    // Destructor
+    ~KubusPendapatan() {
+        delete[] harian;
+        delete[] kumulatif;
+    }
+    
+    // Kubus dimiliki oleh SistemPembayaran, tidak boleh di-copy
+    KubusPendapatan(const KubusPendapatan&) = delete;
+    KubusPendapatan& operator=(const KubusPendapatan&) = delete;
+    
+    // Bit status / metode untuk mask query
+    static unsigned bitStatus(StatusTransaksi status) {
+        return 1u << static_cast<int>(status);
+    }
+    
+    static unsigned bitMetode(MetodePembayaran metode) {
+        return 1u << static_cast<int>(metode);
+    }
+    
+    static const unsigned SEMUA = 0xFu;
+    
+    // Tambahkan (arah = 1) / kurangi (arah = -1) transaksi ke sel harinya
+    // Transaksi dengan tanggal tidak valid tidak dicatat
+    void catat(const Transaksi* t, int arah) {
+        int hari;
+        if (!KalenderKamar::tanggalKeHari(t->getTanggalTransaksi(), hari)) return;
+        
+        pastikanJangkauan(hari);
+        int baris = hari - hariAwal;
+        SelPendapatan& sel = harian[(size_t)baris * SEL_PER_HARI +
+                                    indexSel(t->getStatus(), t->getMetodeBayar())];
+        
+        sel.jumlahTransaksi += arah;
+        sel.pendapatan += t->getTotalAkhir() * arah;
+        
+        if (t->getJumlahItem() == 0 || !t->isItemLengkap()) {
+            sel.tanpaRincian += t->getTotalAkhir() * arah;
+        } else {
+            // Breakdown by item type, sisanya pajak + service
+            Rupiah subtotalItem;
+            for (int i = 0; i < t->getJumlahItem(); i++) {
+                const ItemBooking* item = t->getItem(i);
+                int jenis = static_cast<int>(item->getJenis());
+                
+                subtotalItem += item->getSubtotal();
+                sel.pendapatanItem[jenis] += item->getSubtotal() * arah;
+                sel.jumlahItem[jenis] += arah;
+            }
+            sel.pajakDanService += (t->getTotalAkhir() - subtotalItem) * arah;
+        }
+        
+        // Prefix setelah hari ini kadaluarsa
+        if (barisSiap > baris) barisSiap = baris;
+    }
+    
+    // Jumlahkan semua sel di hari [hariMulai, hariSelesai] (inklusif) yang
+    // status & metodenya ada di mask - O(status x metode)
+    SelPendapatan jumlahkan(int hariMulai, int hariSelesai,
+                            unsigned maskStatus = SEMUA, unsigned maskMetode = SEMUA) {
+        SelPendapatan hasil;
+        if (hariMulai < hariAwal) hariMulai = hariAwal;
+        if (hariSelesai > hariAwal + jumlahHari - 1) hariSelesai = hariAwal + jumlahHari - 1;
+        if (jumlahHari == 0 || hariMulai > hariSelesai) return hasil;
+        
+        int awal = hariMulai - hariAwal;
+        int akhir = hariSelesai - hariAwal + 1;
+        siapkanKumulatif(akhir);
+        
+        const SelPendapatan* barisAwal = kumulatif + (size_t)awal * SEL_PER_HARI;
+        const SelPendapatan* barisAkhir = kumulatif + (size_t)akhir * SEL_PER_HARI;
+        for (int s = 0; s < JUMLAH_STATUS; s++) {
+            if (!(maskStatus & (1u << s))) continue;
+            
+            for (int m = 0; m < JUMLAH_METODE; m++) {
+                if (!(maskMetode & (1u << m))) continue;
+                
+                int i = s * JUMLAH_METODE + m;
+                hasil += barisAkhir[i];
+                hasil -= barisAwal[i];
+            }
+        }
+        return hasil;
+    }
+    
+    // Kosongkan semua sel (jangkauan tetap dipakai ulang)
+    void clear() {
+        for (size_t i = 0; i < (size_t)jumlahHari * SEL_PER_HARI; i++) {
+            harian[i] = SelPendapatan();
+        }
+        barisSiap = 0;
+    }
+    
+    // Getter
+    int getHariAwal() const { return hariAwal; }
+    int getJumlahHari() const { return jumlahHari; }
+};
+
+#endif
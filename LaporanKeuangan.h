@@ -6,6 +6,8 @@
 #include "CircularLinkedList.h"
 #include "PengelolaFile.h"
 #include "Transaksi.h"
+#include "KalenderKamar.h"
+#include "KubusPendapatan.h"
 #include "SistemPembayaran.h"
 using namespace std;
 
@@ -13,35 +15,30 @@ using namespace std;
 // LAPORAN KEUANGAN - DETAIL REPORTING BY PERIOD
 // ============================================================================
 // Generate laporan: Harian, Mingguan, Bulanan dengan summary & breakdown
+// Angka diambil dari rekap harian SistemPembayaran (KubusPendapatan), bukan
+// scan semua transaksi: satu rentang = O(status x metode), berapapun
+// jumlah transaksi & panjang rentangnya
 // ============================================================================
 
 class LaporanKeuangan {
 private:
     SistemPembayaran* sistemPembayaran;
     
-    // Helper: Parse tanggal DD/MM/YYYY ke integer YYYYMMDD untuk comparison
-    int parseTanggalKeInt(const string& tanggal) const {
-        // Format: DD/MM/YYYY ? YYYYMMDD
-        if (tanggal.length() < 10) return 0;
-        
-        string hari = tanggal.substr(0, 2);
-        string bulan = tanggal.substr(3, 2);
-        string tahun = tanggal.substr(6, 4);
-        
-        try {
-            int y = stoi(tahun);
-            int m = stoi(bulan);
-            int d = stoi(hari);
-            return y * 10000 + m * 100 + d;
-        } catch (...) {
-            return 0;
+    // Helper: Parse rentang tanggal laporan ke nomor hari (KalenderKamar)
+    static bool parseRangeHari(const string& tanggalMulai, const string& tanggalSelesai,
+                               int& hariMulai, int& hariSelesai) {
+        if (!KalenderKamar::tanggalKeHari(tanggalMulai, hariMulai) ||
+            !KalenderKamar::tanggalKeHari(tanggalSelesai, hariSelesai)) {
+            cout << "\n[ERROR] Format tanggal tidak valid! Gunakan DD/MM/YYYY." << endl;
+            return false;
         }
+        return true;
     }
     
-    // Helper: Cek apakah tanggal dalam range
-    bool dalamRange(const string& tanggal, int tanggalMulai, int tanggalSelesai) const {
-        int tgl = parseTanggalKeInt(tanggal);
-        return tgl >= tanggalMulai && tgl <= tanggalSelesai;
+    // Helper: Status yang dihitung sebagai pendapatan
+    static unsigned maskPendapatan() {
+        return KubusPendapatan::bitStatus(StatusTransaksi::CONFIRMED) |
+               KubusPendapatan::bitStatus(StatusTransaksi::COMPLETED);
     }
     
     // Helper: Get tanggal hari ini (simplified - gunakan tanggal sistem)
@@ -49,31 +46,14 @@ private:
         // Simplified: Return fixed date atau bisa pakai <ctime>
         return "03/01/2026";
     }
-    
-    // Helper: Calculate range untuk periode
-    void hitungRangeTanggal(const string& periode, int& mulai, int& selesai) {
-        // Simplified calculation
-        if (periode == "hari_ini") {
-            mulai = selesai = parseTanggalKeInt(getTanggalHariIni());
-        } else if (periode == "7_hari") {
-            selesai = parseTanggalKeInt(getTanggalHariIni());
-            mulai = selesai - 7; // Simplified
-        } else if (periode == "minggu_ini") {
-            selesai = parseTanggalKeInt(getTanggalHariIni());
-            mulai = selesai - 7;
-        } else if (periode == "bulan_ini") {
-            selesai = parseTanggalKeInt(getTanggalHariIni());
-            mulai = 20260101; // Awal bulan (simplified)
-        }
-    }
 
 public:
     LaporanKeuangan(SistemPembayaran* sp) : sistemPembayaran(sp) {}
     
     // Generate laporan by custom date range
     void laporanByRange(const string& tanggalMulai, const string& tanggalSelesai) {
-        int tglMulai = parseTanggalKeInt(tanggalMulai);
-        int tglSelesai = parseTanggalKeInt(tanggalSelesai);
+        int hariMulai, hariSelesai;
+        if (!parseRangeHari(tanggalMulai, tanggalSelesai, hariMulai, hariSelesai)) return;
         
         cout << "\n+------------------------------------------------------------+" << endl;
         cout << "          LAPORAN KEUANGAN - CUSTOM RANGE                   " << endl;
@@ -82,32 +62,21 @@ public:
              << string(26 - tanggalMulai.length() - tanggalSelesai.length(), ' ') << "" << endl;
         cout << "+------------------------------------------------------------+" << endl;
         
-        // Data aggregation
-        int totalTransaksi = 0;
-        double totalPendapatan = 0.0;
-        double pendapatanKamar = 0.0;
-        double pendapatanLayanan = 0.0;
-        int jumlahKamarTerjual = 0;
-        int jumlahLayananTerjual = 0;
+        // Rincian item baru dimuat saat laporan pertama kali dibuat
+        sistemPembayaran->muatItemTransaksi();
         
-        // Iterate transaksi
-        CircularLinkedList<Transaksi*>& daftarTransaksi = sistemPembayaran->getDaftarTransaksi();
+        // Data aggregation - selisih prefix sum rekap harian
+        KubusPendapatan& kubus = sistemPembayaran->getKubusPendapatan();
+        SelPendapatan rekap = kubus.jumlahkan(hariMulai, hariSelesai, maskPendapatan());
         
-        daftarTransaksi.iterasi([&](Transaksi* t) {
-            if (dalamRange(t->getTanggalTransaksi(), tglMulai, tglSelesai)) {
-                if (t->getStatus() == StatusTransaksi::CONFIRMED || 
-                    t->getStatus() == StatusTransaksi::COMPLETED) {
-                    
-                    totalTransaksi++;
-                    totalPendapatan += t->getTotalAkhir();
-                    
-                    // Breakdown by item type (simplified - bisa iterate items)
-                    jumlahKamarTerjual++;
-                    pendapatanKamar += t->getTotalAkhir() * 0.7; // Estimasi 70% dari kamar
-                    pendapatanLayanan += t->getTotalAkhir() * 0.3; // 30% dari layanan
-                }
-            }
-        });
+        int totalTransaksi = rekap.jumlahTransaksi;
+        Rupiah totalPendapatan = rekap.pendapatan;
+        Rupiah pendapatanKamar = rekap.pendapatanItem[static_cast<int>(JenisItem::KAMAR)];
+        Rupiah pendapatanLayanan = rekap.pendapatanItem[static_cast<int>(JenisItem::LAYANAN)];
+        Rupiah pajakDanService = rekap.pajakDanService;
+        Rupiah tanpaRincian = rekap.tanpaRincian;   // Transaksi lama yang itemnya tidak tersimpan
+        int jumlahKamarTerjual = rekap.jumlahItem[static_cast<int>(JenisItem::KAMAR)];
+        int jumlahLayananTerjual = rekap.jumlahItem[static_cast<int>(JenisItem::LAYANAN)];
         
         // Display summary
         cout << "\n+--------------------------- SUMMARY ------------------------+" << endl;
@@ -117,7 +86,7 @@ public:
              << string(max(0, 32 - (int)PengelolaFile::formatRupiahLengkap(totalPendapatan).length()), ' ') << "" << endl;
         
         if (totalTransaksi > 0) {
-            double rata = totalPendapatan / totalTransaksi;
+            Rupiah rata = totalPendapatan.bagi(totalTransaksi);
             cout << " Rata-rata per Transaksi : " 
                  << PengelolaFile::formatRupiah(rata).substr(0, 32)
                  << string(max(0, 32 - (int)PengelolaFile::formatRupiah(rata).length()), ' ') << "" << endl;
@@ -134,8 +103,32 @@ public:
              << PengelolaFile::formatRupiah(pendapatanLayanan).substr(0, 32)
              << string(max(0, 32 - (int)PengelolaFile::formatRupiah(pendapatanLayanan).length()), ' ') << "" << endl;
         cout << " Jumlah Layanan Terjual  : " << jumlahLayananTerjual << string(32, ' ') << "" << endl;
+        cout << " Pajak + Service         : " 
+             << PengelolaFile::formatRupiah(pajakDanService).substr(0, 32)
+             << string(max(0, 32 - (int)PengelolaFile::formatRupiah(pajakDanService).length()), ' ') << "" << endl;
+        
+        if (!tanpaRincian.nol()) {
+            cout << " Tanpa Rincian Item      : " 
+                 << PengelolaFile::formatRupiah(tanpaRincian).substr(0, 32)
+                 << string(max(0, 32 - (int)PengelolaFile::formatRupiah(tanpaRincian).length()), ' ') << "" << endl;
+        }
         cout << "+------------------------------------------------------------+" << endl;
         
+        if (totalTransaksi > 0) {
+            cout << "\n+------------------- PER METODE PEMBAYARAN ------------------+" << endl;
+            for (int m = 0; m < 4; m++) {
+                MetodePembayaran metode = static_cast<MetodePembayaran>(m);
+                SelPendapatan perMetode = kubus.jumlahkan(hariMulai, hariSelesai, maskPendapatan(),
+                                                          KubusPendapatan::bitMetode(metode));
+                string label = Transaksi::metodeKeString(metode) + " (" +
+                               to_string(perMetode.jumlahTransaksi) + ")";
+                string nilai = PengelolaFile::formatRupiah(perMetode.pendapatan);
+                cout << " " << label << string(max(0, 24 - (int)label.length()), ' ') << ": "
+                     << nilai.substr(0, 32) << string(max(0, 32 - (int)nilai.length()), ' ') << "" << endl;
+            }
+            cout << "+------------------------------------------------------------+" << endl;
+        }
+        
         if (totalTransaksi == 0) {
             cout << "\n[INFO] Tidak ada transaksi dalam periode ini." << endl;
         }
@@ -250,6 +243,8 @@ public:
     // Export laporan ke file (bonus feature)
     bool exportLaporanToFile(const string& tanggalMulai, const string& tanggalSelesai, 
                             const string& namaFile = "laporan_keuangan.txt") {
+        int hariMulai, hariSelesai;
+        if (!parseRangeHari(tanggalMulai, tanggalSelesai, hariMulai, hariSelesai)) return false;
         
         // Simplified: Write summary to file
         string baris[100];
@@ -262,22 +257,13 @@ public:
         baris[idx++] = "========================================";
         baris[idx++] = "";
         
-        // Calculate data
-        int totalTransaksi = 0;
-        double totalPendapatan = 0.0;
-        
-        int tglMulai = parseTanggalKeInt(tanggalMulai);
-        int tglSelesai = parseTanggalKeInt(tanggalSelesai);
-        
-        sistemPembayaran->getDaftarTransaksi().iterasi([&](Transaksi* t) {
-            if (dalamRange(t->getTanggalTransaksi(), tglMulai, tglSelesai)) {
-                if (t->getStatus() == StatusTransaksi::CONFIRMED || 
-                    t->getStatus() == StatusTransaksi::COMPLETED) {
-                    totalTransaksi++;
-                    totalPendapatan += t->getTotalAkhir();
-                }
-            }
-        });
+        // Calculate data (item ikut dimuat agar rekap punya rincian item,
+        // sama seperti laporanByRange)
+        sistemPembayaran->muatItemTransaksi();
+        SelPendapatan rekap = sistemPembayaran->getKubusPendapatan().jumlahkan(
+            hariMulai, hariSelesai, maskPendapatan());
+        int totalTransaksi = rekap.jumlahTransaksi;
+        Rupiah totalPendapatan = rekap.pendapatan;
         
         baris[idx++] = "Total Transaksi: " + to_string(totalTransaksi);
         baris[idx++] = "Total Pendapatan: " + PengelolaFile::formatRupiahLengkap(totalPendapatan);
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "PengelolaFile.h"
 using namespace std;
 
@@ -42,38 +43,41 @@ protected:
     string idLayanan;
     string namaLayanan;
     KategoriLayanan kategori;
-    double harga;
+    Rupiah harga;
     SatuanHarga satuan;
     bool tersedia;
     string deskripsi;
     int minimumOrder; // Minimum pemesanan (misalnya catering min 20 pax)
+    bool perluDisimpan; // Dirty flag: berubah sejak terakhir ditulis ke file
 
 public:
     // Constructor
-    Layanan(const string& _id, const string& _nama, KategoriLayanan _kategori,
-            double _harga, SatuanHarga _satuan, const string& _deskripsi = "",
+    Layanan(string _id, string _nama, KategoriLayanan _kategori,
+            const Rupiah& _harga, SatuanHarga _satuan, string _deskripsi = "",
             int _minOrder = 1)
-        : idLayanan(_id), namaLayanan(_nama), kategori(_kategori),
+        : idLayanan(std::move(_id)), namaLayanan(std::move(_nama)), kategori(_kategori),
           harga(_harga), satuan(_satuan), tersedia(true), 
-          deskripsi(_deskripsi), minimumOrder(_minOrder) {}
+          deskripsi(std::move(_deskripsi)), minimumOrder(_minOrder), perluDisimpan(false) {}
     
     virtual ~Layanan() {}
     
     // Getter
-    string getIdLayanan() const { return idLayanan; }
-    string getNamaLayanan() const { return namaLayanan; }
+    const string& getIdLayanan() const { return idLayanan; }
+    const string& getNamaLayanan() const { return namaLayanan; }
     KategoriLayanan getKategori() const { return kategori; }
-    double getHarga() const { return harga; }
+    Rupiah getHarga() const { return harga; }
     SatuanHarga getSatuan() const { return satuan; }
     bool isTersedia() const { return tersedia; }
-    string getDeskripsi() const { return deskripsi; }
+    const string& getDeskripsi() const { return deskripsi; }
     int getMinimumOrder() const { return minimumOrder; }
+    bool isPerluDisimpan() const { return perluDisimpan; }
     
     // Setter
-    void setHarga(double _harga) { harga = _harga; }
+    void setHarga(const Rupiah& _harga) { harga = _harga; }
     void setTersedia(bool _tersedia) { tersedia = _tersedia; }
-    void setDeskripsi(const string& _deskripsi) { deskripsi = _deskripsi; }
+    void setDeskripsi(string _deskripsi) { deskripsi = std::move(_deskripsi); }
     void setMinimumOrder(int _min) { minimumOrder = _min; }
+    void setPerluDisimpan(bool _perlu) { perluDisimpan = _perlu; }
     
     // Helper: Convert kategori ke string
     string getKategoriString() const {
@@ -131,7 +135,7 @@ public:
     }
     
     // Hitung total harga berdasarkan kuantitas
-    virtual double hitungTotal(int kuantitas) const {
+    virtual Rupiah hitungTotal(int kuantitas) const {
         if (kuantitas < minimumOrder) {
             return harga * minimumOrder;
         }
@@ -165,7 +169,7 @@ public:
         fields[0] = getKategoriString();
         fields[1] = idLayanan;
         fields[2] = namaLayanan;
-        fields[3] = to_string(static_cast<long long>(harga));
+        fields[3] = harga.toString();
         fields[4] = getSatuanString();
         fields[5] = (tersedia ? "1" : "0");
         fields[6] = to_string(minimumOrder);
@@ -185,9 +189,9 @@ private:
     bool adaSoundSystem;
 
 public:
-    LayananBallroom(const string& _id, const string& _nama, double _harga,
+    LayananBallroom(string _id, string _nama, const Rupiah& _harga,
                     int _kapasitas, bool _proyektor = true, bool _sound = true)
-        : Layanan(_id, _nama, KategoriLayanan::BALLROOM, _harga, 
+        : Layanan(std::move(_id), std::move(_nama), KategoriLayanan::BALLROOM, _harga, 
                   SatuanHarga::PER_EVENT, 
                   "Ballroom untuk wedding, seminar, meeting - Kapasitas: " + 
                   to_string(_kapasitas) + " orang", 1),
@@ -212,14 +216,14 @@ private:
     string jenisMenu; // Prasmanan, A la carte, Set menu
 
 public:
-    LayananRestaurant(const string& _id, const string& _nama, double _harga,
+    LayananRestaurant(string _id, string _nama, const Rupiah& _harga,
                       const string& _jenisMenu = "Prasmanan")
-        : Layanan(_id, _nama, KategoriLayanan::RESTAURANT, _harga,
+        : Layanan(std::move(_id), std::move(_nama), KategoriLayanan::RESTAURANT, _harga,
                   SatuanHarga::PER_ORANG, 
                   "Fine dining restaurant - Menu: " + _jenisMenu, 1),
           jenisMenu(_jenisMenu) {}
     
-    string getJenisMenu() const { return jenisMenu; }
+    const string& getJenisMenu() const { return jenisMenu; }
 };
 
 // ============================================================================
@@ -230,8 +234,8 @@ private:
     int waktuPengerjaanHari; // Berapa hari selesai
 
 public:
-    LayananLaundry(const string& _id, double _harga, int _waktuHari = 2)
-        : Layanan(_id, "Laundry Service", KategoriLayanan::LAUNDRY, _harga,
+    LayananLaundry(string _id, const Rupiah& _harga, int _waktuHari = 2)
+        : Layanan(std::move(_id), "Laundry Service", KategoriLayanan::LAUNDRY, _harga,
                   SatuanHarga::PER_KG, 
                   "Cuci + setrika + pewangi - Selesai " + to_string(_waktuHari) + " hari", 1),
           waktuPengerjaanHari(_waktuHari) {}
@@ -247,14 +251,14 @@ private:
     string jamOperasional;
 
 public:
-    LayananKolamRenang(const string& _id, double _harga, 
+    LayananKolamRenang(string _id, const Rupiah& _harga, 
                        const string& _jamOps = "06:00 - 22:00")
-        : Layanan(_id, "Swimming Pool Access", KategoriLayanan::KOLAM_RENANG, 
+        : Layanan(std::move(_id), "Swimming Pool Access", KategoriLayanan::KOLAM_RENANG, 
                   _harga, SatuanHarga::PER_HARI,
                   "Akses kolam renang - Jam operasional: " + _jamOps, 1),
           jamOperasional(_jamOps) {}
     
-    string getJamOperasional() const { return jamOperasional; }
+    const string& getJamOperasional() const { return jamOperasional; }
 };
 
 // ============================================================================
@@ -265,8 +269,8 @@ private:
     bool personalTrainer;
 
 public:
-    LayananGym(const string& _id, double _harga, bool _trainer = false)
-        : Layanan(_id, "Gym & Fitness Center", KategoriLayanan::GYM, _harga,
+    LayananGym(string _id, const Rupiah& _harga, bool _trainer = false)
+        : Layanan(std::move(_id), "Gym & Fitness Center", KategoriLayanan::GYM, _harga,
                   SatuanHarga::PER_SESI,
                   "Akses gym lengkap" + 
                   string(_trainer ? " + Personal Trainer" : ""), 1),
@@ -283,15 +287,15 @@ private:
     string jenisKendaraan; // Sedan, SUV, Van
 
 public:
-    LayananTransferBandara(const string& _id, double _harga,
+    LayananTransferBandara(string _id, const Rupiah& _harga,
                            const string& _kendaraan = "Sedan")
-        : Layanan(_id, "Airport Transfer", KategoriLayanan::TRANSFER_BANDARA,
+        : Layanan(std::move(_id), "Airport Transfer", KategoriLayanan::TRANSFER_BANDARA,
                   _harga, SatuanHarga::PER_TRIP,
                   "Layanan antar-jemput bandara - Kendaraan: " + _kendaraan + 
                   " (24/7 available)", 1),
           jenisKendaraan(_kendaraan) {}
     
-    string getJenisKendaraan() const { return jenisKendaraan; }
+    const string& getJenisKendaraan() const { return jenisKendaraan; }
 };
 
 // ============================================================================
@@ -302,14 +306,14 @@ private:
     string paketMenu;
 
 public:
-    LayananCatering(const string& _id, double _harga,
+    LayananCatering(string _id, const Rupiah& _harga,
                     const string& _paketMenu = "Paket Premium", int _minOrder = 20)
-        : Layanan(_id, "Catering Service", KategoriLayanan::CATERING, _harga,
+        : Layanan(std::move(_id), "Catering Service", KategoriLayanan::CATERING, _harga,
                   SatuanHarga::PER_ORANG,
                   "Layanan catering untuk event - " + _paketMenu, _minOrder),
           paketMenu(_paketMenu) {}
     
-    string getPaketMenu() const { return paketMenu; }
+    const string& getPaketMenu() const { return paketMenu; }
 };
 
 #endif
@@ -0,0 +1,146 @@
+#ifndef LOG_PERUBAHAN_H
+#define LOG_PERUBAHAN_H
+
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include "PengelolaFile.h"
+#include "PotonganString.h"
+using namespace std;
+
+// ============================================================================
+// LOG PERUBAHAN - APPEND-ONLY WRITE-AHEAD LOG
+// ============================================================================
+// Perubahan kecil dicatat sebagai record baru di akhir file log, bukan
+// menulis ulang seluruh file data. Saat load, log diputar ulang di atas
+// snapshot; saat kompaksi, snapshot ditulis ulang dan log dikosongkan
+// Format baris: JENIS|field1|field2|...  (contoh: STATUS|T001|COMPLETED)
+// - Setiap record langsung di-fflush (aman jika program crash)
+// - fsync dikumpulkan per BATAS_SINKRON record (aman jika OS crash,
+//   kecuali record terakhir yang belum di-fsync)
+// ============================================================================
+
+class LogPerubahan {
+private:
+    string namaFile;
+    FILE* file;           // Dibuka append saat record pertama ditulis
+    int jumlahRecord;     // Record di log sejak kompaksi terakhir
+    int belumDisinkron;   // Record sejak fsync terakhir
+    int batasSinkron;
+    
+    static const int MAKS_FIELD = 16;
+    
+    // Helper: Buka file log (append) jika belum terbuka
+    bool bukaJikaPerlu() {
+        if (file == nullptr) {
+            file = fopen(namaFile.c_str(), "a");
+            if (file == nullptr) {
+                PengelolaFile::cetakBaris("[ERROR] Tidak dapat membuka log: " + namaFile);
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    // Helper: Tutup file log (sisa record di-fsync dulu)
+    void tutup() {
+        if (file == nullptr) return;
+        
+        if (belumDisinkron > 0) {
+            PengelolaFile::sinkronkanFile(file);
+            belumDisinkron = 0;
+        }
+        fclose(file);
+        file = nullptr;
+    }
+
+public:
+    // Constructor
+    LogPerubahan(const string& _namaFile, int _batasSinkron = 32)
+        : namaFile(_namaFile), file(nullptr), jumlahRecord(0),
+          belumDisinkron(0), batasSinkron(_batasSinkron) {}
+    
+    // Destructor
+    ~LogPerubahan() {
+        tutup();
+    }
+    
+    LogPerubahan(const LogPerubahan&) = delete;
+    LogPerubahan& operator=(const LogPerubahan&) = delete;
+    
+    // Tambah satu record di akhir log
+    bool tambahRecord(const string& jenis, const string fields[], int jumlah) {
+        if (!bukaJikaPerlu()) return false;
+        
+        string baris = jenis;
+        for (int i = 0; i < jumlah; i++) {
+            baris += PengelolaFile::DELIMITER;
+            baris += fields[i];
+        }
+        baris += '\n';
+        
+        if (fwrite(baris.data(), 1, baris.length(), file) != baris.length() ||
+            fflush(file) != 0) {
+            PengelolaFile::cetakBaris("[ERROR] Gagal menulis log: " + namaFile);
+            return false;
+        }
+        
+        jumlahRecord++;
+        belumDisinkron++;
+        
+        if (belumDisinkron >= batasSinkron) {
+            return sinkronkan();
+        }
+        return true;
+    }
+    
+    // Paksa semua record yang sudah ditulis tersimpan ke disk
+    bool sinkronkan() {
+        if (file == nullptr || belumDisinkron == 0) return true;
+        
+        belumDisinkron = 0;
+        return PengelolaFile::sinkronkanFile(file);
+    }
+    
+    // Putar ulang semua record: func(const PotonganString fields[], int jumlah)
+    // fields[0] adalah jenis record. Return jumlah record
+    template<typename Function>
+    int putarUlang(Function func) {
+        if (!PengelolaFile::fileExists(namaFile)) {
+            jumlahRecord = 0;
+            return 0;
+        }
+        
+        jumlahRecord = PengelolaFile::bacaPerBaris(namaFile, [&](const string& baris) {
+            PotonganString fields[MAKS_FIELD];
+            int jumlah;
+            PengelolaFile::splitPotongan(baris, PengelolaFile::DELIMITER, fields, MAKS_FIELD, jumlah);
+            
+            if (jumlah > 0) {
+                func(fields, jumlah);
+            }
+        });
+        
+        return jumlahRecord;
+    }
+    
+    // Kosongkan log (dipanggil setelah snapshot berhasil ditulis)
+    bool kosongkan() {
+        tutup();
+        
+        PenulisFile penulis(namaFile);
+        if (!penulis.terbuka() || !penulis.tutup()) {
+            PengelolaFile::cetakBaris("[ERROR] Gagal mengosongkan log: " + namaFile);
+            return false;
+        }
+        
+        jumlahRecord = 0;
+        return true;
+    }
+    
+    // Getter
+    int getJumlahRecord() const { return jumlahRecord; }
+    const string& getNamaFile() const { return namaFile; }
+};
+
+#endif
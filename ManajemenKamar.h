@@ -3,9 +3,14 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "CircularLinkedList.h"
-#include "BinarySearchTree.h"
+#include "IndeksKunci.h"
 #include "PengelolaFile.h"
+#include "LogPerubahan.h"
+#include "SnapshotBiner.h"
+#include "KalenderKamar.h"
+#include "IndeksKamar.h"
 #include "Kamar.h"
 using namespace std;
 
@@ -13,27 +18,138 @@ using namespace std;
 // MANAJEMEN KAMAR - CRUD & SEARCH
 // ============================================================================
 // Mengelola semua operasi kamar: Create, Read, Update, Delete, Search
-// Menggunakan BST untuk pencarian cepat berdasarkan nomor kamar
+// Index nomor kamar (IndeksKunci: sorted array, BST/AVL per parameter template)
+// dan index bitmap (IndeksKamar) untuk filter tipe/status/lantai/kapasitas/harga
+// Penyimpanan: kamar.txt (snapshot) + kamar.log (delta)
+// - Update hanya menandai kamar (dirty flag) & memasukkannya ke antrian
+// - Setiap BATAS_PERUBAHAN perubahan, hanya kamar yang berubah ditulis ke log
+// - Snapshot ditulis ulang saat keluar atau log mencapai BATAS_KOMPAKSI
+// Okupansi per tanggal ada di KalenderKamar (diisi SistemPembayaran dari
+// item booking), StatusKamar hanya kondisi kamar saat ini
 // ============================================================================
 
 class ManajemenKamar {
 private:
     CircularLinkedList<Kamar*> daftarKamar;
-    BinarySearchTree<Kamar*, string> indexKamar; // BST untuk search by nomor
+    IndeksKunci<Kamar*, string, StrukturIndeks::TERURUT> indexKamar;   // Index search by nomor (lihat IndeksKunci.h)
+    IndeksKamar indexAtribut;                 // Bitmap untuk search by atribut
+    KalenderKamar kalender;                   // Okupansi per malam, semua kamar
     string namaFileKamar;
+    LogPerubahan logKamar;
+    CircularLinkedList<Kamar*> antrianSimpan; // Kamar dengan dirty flag aktif
+    int jumlahPerubahan;                      // Perubahan sejak flush terakhir
     
-    // Helper: Rebuild BST index
+    static const int BATAS_PERUBAHAN = 16;
+    static const int BATAS_KOMPAKSI = 2000;
+    
+    // Helper: Buat objek kamar sesuai tipe, nullptr jika tipe tidak dikenal
+    static Kamar* buatKamar(TipeKamar tipe, string nomor, int lantai,
+                            bool balkon, bool pemandangan) {
+        switch (tipe) {
+            case TipeKamar::STANDARD:
+                return new KamarStandard(std::move(nomor), lantai);
+            case TipeKamar::DELUXE:
+                return new KamarDeluxe(std::move(nomor), lantai, balkon);
+            case TipeKamar::SUITE:
+                return new KamarSuite(std::move(nomor), lantai, pemandangan);
+            case TipeKamar::PRESIDENTIAL:
+                return new KamarPresidential(std::move(nomor), lantai);
+        }
+        return nullptr;
+    }
+    
+    // Helper: Buat kamar dari field baris file, nullptr jika tidak valid
+    static Kamar* parseKamar(const PotonganString fields[], int fieldCount) {
+        if (fieldCount < 9) return nullptr;
+        
+        Rupiah harga;
+        int lantai, kapasitas;
+        if (!PengelolaFile::parseRupiah(fields[3], harga) ||
+            !PengelolaFile::parseInt(fields[4], lantai) ||
+            !PengelolaFile::parseInt(fields[5], kapasitas)) {
+            return nullptr; // Skip baris dengan angka tidak valid
+        }
+        
+        string nomor = fields[1].toString();
+        bool balkon = (fields[6] == "1");
+        bool pemandangan = (fields[7] == "1");
+        
+        TipeKamar tipe = Kamar::stringKeTipe(fields[0].toString());
+        StatusKamar status = Kamar::stringKeStatus(fields[2].toString());
+        
+        Kamar* kamar = buatKamar(tipe, std::move(nomor), lantai, balkon, pemandangan);
+        
+        if (kamar != nullptr) {
+            kamar->setStatus(status);
+            kamar->setHargaPerMalam(harga); // Override jika harga custom
+        }
+        
+        return kamar;
+    }
+    
+    // Helper: Tandai kamar berubah, flush ke log setiap BATAS_PERUBAHAN perubahan
+    void tandaiBerubah(Kamar* kamar) {
+        if (!kamar->isPerluDisimpan()) {
+            kamar->setPerluDisimpan(true);
+            antrianSimpan.tambah(kamar);
+        }
+        
+        if (++jumlahPerubahan >= BATAS_PERUBAHAN) {
+            simpanPerubahan();
+        }
+    }
+    
+    // Helper: Rebuild index (bulk build, bukan insert satu per satu)
     void rebuildIndex() {
-        indexKamar.clear();
+        int jumlah = daftarKamar.ukuran();
+        Kamar** data = new Kamar*[jumlah];
+        string* kunci = new string[jumlah];
+        
+        int i = 0;
+        indexAtribut.clear();
         daftarKamar.iterasi([&](Kamar* k) {
-            indexKamar.insert(k, k->getNomorKamar());
+            data[i] = k;
+            kunci[i] = k->getNomorKamar();
+            indexAtribut.tambah(k);
+            kalender.daftarkanKamar(k->getNomorKamar());
+            i++;
         });
+        
+        indexKamar.bangunDariTerurut(data, kunci, jumlah);
+        
+        delete[] data;
+        delete[] kunci;
+    }
+    
+    // Helper: Satu baris okupansi di tabel statistik (lebar isi 60 kolom)
+    static void tampilkanBarisOkupansi(const string& label, int terisi, int total) {
+        string isi = "    " + label + string(label.length() < 14 ? 14 - label.length() : 0, ' ') +
+                     ": " + to_string(terisi) + "/" + to_string(total) + " terisi (" +
+                     to_string(terisi * 100 / total) + "%)";
+        if (isi.length() < 60) isi += string(60 - isi.length(), ' ');
+        cout << "" << isi << "" << endl;
+    }
+    
+    // Helper: Tampilkan ringkasan satu kamar (daftar kamar tersedia / hasil cari)
+    static void tampilkanRingkasKamar(const Kamar* k, int urutan) {
+        cout << "\n[" << urutan << "] " << k->getNomorKamar() 
+             << " - " << k->getTipeString() << endl;
+        cout << "Harga/Malam : " << PengelolaFile::formatRupiahLengkap(k->getHargaPerMalam()) << endl;
+        cout << "Lantai " << k->getLantai() << " | Kapasitas " << k->getKapasitasOrang() << " orang";
+        if (k->hasBalkon()) cout << " | Balkon";
+        if (k->hasPemandanganLaut()) cout << " | View Laut";
+        cout << endl;
+        cout << "Fasilitas: " << k->getFasilitas().substr(0, 55);
+        if (k->getFasilitas().length() > 55) cout << "...";
+        cout << endl;
+        cout << "-----------------------------------------------------------" << endl;
     }
 
 public:
     // Constructor
     ManajemenKamar(const string& namaFile = "kamar.txt") 
-        : namaFileKamar(namaFile) {
+        : namaFileKamar(namaFile), logKamar(PengelolaFile::gantiEkstensi(namaFile, ".log")),
+          jumlahPerubahan(0) {
         PengelolaFile::buatFileJikaBelumAda(namaFileKamar);
     }
     
@@ -44,79 +160,161 @@ public:
         });
     }
     
-    // Load data kamar dari file
+    // Load data kamar dari snapshot, lalu putar ulang log
     bool muatDataKamar() {
-        string baris[1000];
-        int jumlah = PengelolaFile::bacaSemuaBaris(namaFileKamar, baris, 1000);
+        PengelolaFile::bacaPerBaris(namaFileKamar, [&](const string& baris) {
+            PotonganString fields[15];
+            int fieldCount;
+            PengelolaFile::splitPotongan(baris, '|', fields, 15, fieldCount);
+            
+            Kamar* kamar = parseKamar(fields, fieldCount);
+            if (kamar != nullptr) {
+                daftarKamar.tambah(kamar);
+            }
+        });
         
-        if (jumlah == 0) {
-            cout << "[INFO] File kamar kosong. Membuat data default..." << endl;
+        // Build index untuk search (dipakai juga saat replay log)
+        rebuildIndex();
+        
+        // KAMAR|<baris kamar> = tambah/ganti, HAPUS|<nomor> = hapus
+        logKamar.putarUlang([&](const PotonganString fields[], int fieldCount) {
+            if (fields[0] == "KAMAR") {
+                Kamar* baru = parseKamar(fields + 1, fieldCount - 1);
+                if (baru == nullptr) return;
+                
+                Kamar* lama = cariKamar(baru->getNomorKamar());
+                if (lama != nullptr) {
+                    // Hanya status & harga yang bisa berubah setelah kamar dibuat
+                    lama->setStatus(baru->getStatus());
+                    lama->setHargaPerMalam(baru->getHargaPerMalam());
+                    indexAtribut.perbarui(lama);
+                    delete baru;
+                } else {
+                    daftarKamar.tambah(baru);
+                    indexKamar.insert(baru, baru->getNomorKamar());
+                    indexAtribut.tambah(baru);
+                    kalender.daftarkanKamar(baru->getNomorKamar());
+                }
+            } else if (fields[0] == "HAPUS" && fieldCount >= 2) {
+                string nomor = fields[1].toString();
+                Kamar* kamar = cariKamar(nomor);
+                if (kamar == nullptr) return;
+                
+                daftarKamar.hapus([&](Kamar* k) { return k == kamar; });
+                indexKamar.hapus(nomor);
+                indexAtribut.hapus(nomor);
+                kalender.hapusKamar(nomor);
+                delete kamar;
+            }
+        });
+        
+        if (daftarKamar.kosong()) {
+            PengelolaFile::cetakBaris("[INFO] File kamar kosong. Membuat data default...");
             return false;
         }
         
-        for (int i = 0; i < jumlah; i++) {
-            string fields[15];
-            int fieldCount;
-            PengelolaFile::split(baris[i], '|', fields, fieldCount);
-            
-            if (fieldCount < 9) continue;
-            
-            string tipeStr = fields[0];
-            string nomor = fields[1];
-            string statusStr = fields[2];
-            double harga = stod(fields[3]);
-            int lantai = stoi(fields[4]);
-            int kapasitas = stoi(fields[5]);
-            bool balkon = (fields[6] == "1");
-            bool pemandangan = (fields[7] == "1");
-            
-            TipeKamar tipe = Kamar::stringKeTipe(tipeStr);
-            StatusKamar status = Kamar::stringKeStatus(statusStr);
-            
-            Kamar* kamar = nullptr;
-            
-            // Buat kamar sesuai tipe
-            switch (tipe) {
-                case TipeKamar::STANDARD:
-                    kamar = new KamarStandard(nomor, lantai);
-                    break;
-                case TipeKamar::DELUXE:
-                    kamar = new KamarDeluxe(nomor, lantai, balkon);
-                    break;
-                case TipeKamar::SUITE:
-                    kamar = new KamarSuite(nomor, lantai, pemandangan);
-                    break;
-                case TipeKamar::PRESIDENTIAL:
-                    kamar = new KamarPresidential(nomor, lantai);
-                    break;
-            }
+        PengelolaFile::cetakBaris("[SUKSES] Berhasil memuat " + to_string(daftarKamar.ukuran()) + " kamar");
+        return true;
+    }
+    
+    // Byte per record kamar di snapshot biner
+    static const size_t LEBAR_RECORD_SNAPSHOT = 4 * sizeof(uint8_t) + sizeof(int32_t) +
+                                                sizeof(int64_t) + sizeof(uint32_t);
+    
+    // Tulis semua kamar ke snapshot biner
+    // Record: tipe, status, balkon, pemandangan, lantai, harga, nomor
+    void tulisSnapshot(PenulisSnapshot& snapshot) const {
+        snapshot.setJumlahData(BagianSnapshot::KAMAR, daftarKamar.ukuran());
+        
+        daftarKamar.iterasi([&](Kamar* k) {
+            snapshot.tulis<uint8_t>(static_cast<uint8_t>(k->getTipe()));
+            snapshot.tulis<uint8_t>(static_cast<uint8_t>(k->getStatus()));
+            snapshot.tulis<uint8_t>(k->hasBalkon() ? 1 : 0);
+            snapshot.tulis<uint8_t>(k->hasPemandanganLaut() ? 1 : 0);
+            snapshot.tulis<int32_t>(k->getLantai());
+            snapshot.tulis<int64_t>(k->getHargaPerMalam().getSen());
+            snapshot.tulisString(k->getNomorKamar());
+        });
+    }
+    
+    // Load kamar dari snapshot biner (sudah divalidasi oleh PembacaSnapshot)
+    bool muatSnapshot(PembacaSnapshot& snapshot) {
+        uint32_t jumlah = snapshot.getJumlahData(BagianSnapshot::KAMAR);
+        
+        // Kamar dikumpulkan dulu, lalu disambung ke list sekaligus
+        Kamar** hasil = new Kamar*[jumlah];
+        int jumlahHasil = 0;
+        
+        for (uint32_t i = 0; i < jumlah; i++) {
+            TipeKamar tipe = static_cast<TipeKamar>(snapshot.baca<uint8_t>());
+            StatusKamar status = static_cast<StatusKamar>(snapshot.baca<uint8_t>());
+            bool balkon = snapshot.baca<uint8_t>() != 0;
+            bool pemandangan = snapshot.baca<uint8_t>() != 0;
+            int lantai = snapshot.baca<int32_t>();
+            Rupiah harga = Rupiah::dariSen(snapshot.baca<int64_t>());
+            const string& nomor = snapshot.bacaString();
             
+            Kamar* kamar = buatKamar(tipe, nomor, lantai, balkon, pemandangan);
             if (kamar != nullptr) {
                 kamar->setStatus(status);
-                kamar->setHargaPerMalam(harga); // Override jika harga custom
-                daftarKamar.tambah(kamar);
+                kamar->setHargaPerMalam(harga);
+                hasil[jumlahHasil++] = kamar;
             }
         }
         
-        // Build index untuk search
+        daftarKamar.tambahBanyak(hasil, hasil + jumlahHasil);
+        delete[] hasil;
+        
         rebuildIndex();
         
-        cout << "[SUKSES] Berhasil memuat " << daftarKamar.ukuran() << " kamar" << endl;
-        return true;
+        if (daftarKamar.kosong()) return false;
+        
+        PengelolaFile::cetakBaris("[SUKSES] Berhasil memuat " + to_string(daftarKamar.ukuran()) + " kamar");
+        return !snapshot.gagal();
     }
     
-    // Simpan semua kamar ke file
+    // Simpan semua kamar ke file snapshot & kosongkan log (kompaksi)
+    // Dipanggil saat keluar program atau log sudah terlalu panjang
     bool simpanDataKamar() {
-        string baris[1000];
-        int jumlah = 0;
+        bool berhasil = PengelolaFile::tulisPerBaris(namaFileKamar, [&](PenulisFile& penulis) {
+            daftarKamar.iterasi([&](Kamar* k) {
+                penulis.tulisBaris(k->toFileFormat());
+            });
+        });
         
-        daftarKamar.iterasi([&](Kamar* k) {
-            if (jumlah < 1000) {
-                baris[jumlah++] = k->toFileFormat();
-            }
+        if (!berhasil) return false;
+        
+        antrianSimpan.iterasi([](Kamar* k) {
+            k->setPerluDisimpan(false);
+        });
+        antrianSimpan.clear();
+        jumlahPerubahan = 0;
+        
+        return logKamar.kosongkan();
+    }
+    
+    // Kosongkan log tanpa menulis snapshot (untuk reset data)
+    bool kosongkanLog() {
+        return logKamar.kosongkan();
+    }
+    
+    // Tulis kamar yang berubah saja ke log (1 record per kamar)
+    bool simpanPerubahan() {
+        bool berhasil = true;
+        string fields[1];
+        
+        antrianSimpan.iterasi([&](Kamar* k) {
+            fields[0] = k->toFileFormat();
+            if (!logKamar.tambahRecord("KAMAR", fields, 1)) berhasil = false;
+            k->setPerluDisimpan(false);
         });
+        antrianSimpan.clear();
+        jumlahPerubahan = 0;
         
-        return PengelolaFile::tulisSemuaBaris(namaFileKamar, baris, jumlah);
+        if (berhasil && logKamar.getJumlahRecord() >= BATAS_KOMPAKSI) {
+            return simpanDataKamar();
+        }
+        return berhasil && logKamar.sinkronkan();
     }
     
     // Tambah kamar baru
@@ -129,22 +327,7 @@ public:
             return false;
         }
         
-        Kamar* kamarBaru = nullptr;
-        
-        switch (tipe) {
-            case TipeKamar::STANDARD:
-                kamarBaru = new KamarStandard(nomor, lantai);
-                break;
-            case TipeKamar::DELUXE:
-                kamarBaru = new KamarDeluxe(nomor, lantai, balkon);
-                break;
-            case TipeKamar::SUITE:
-                kamarBaru = new KamarSuite(nomor, lantai, pemandangan);
-                break;
-            case TipeKamar::PRESIDENTIAL:
-                kamarBaru = new KamarPresidential(nomor, lantai);
-                break;
-        }
+        Kamar* kamarBaru = buatKamar(tipe, nomor, lantai, balkon, pemandangan);
         
         if (kamarBaru == nullptr) {
             cout << "[ERROR] Gagal membuat kamar!" << endl;
@@ -153,7 +336,9 @@ public:
         
         daftarKamar.tambah(kamarBaru);
         indexKamar.insert(kamarBaru, nomor);
-        simpanDataKamar();
+        indexAtribut.tambah(kamarBaru);
+        kalender.daftarkanKamar(nomor);
+        tandaiBerubah(kamarBaru);
         
         cout << "[SUKSES] Kamar " << nomor << " (" << kamarBaru->getTipeString() 
              << ") berhasil ditambahkan!" << endl;
@@ -161,7 +346,7 @@ public:
         return true;
     }
     
-    // Cari kamar by nomor (menggunakan BST - O(log n))
+    // Cari kamar by nomor (binary search di index - O(log n))
     Kamar* cariKamar(const string& nomor) {
         Kamar** found = indexKamar.search(nomor);
         if (found != nullptr) {
@@ -180,7 +365,8 @@ public:
         }
         
         kamar->setStatus(statusBaru);
-        simpanDataKamar();
+        indexAtribut.perbarui(kamar);
+        tandaiBerubah(kamar);
         
         cout << "[SUKSES] Status kamar " << nomor << " diubah menjadi: " 
              << kamar->getStatusString() << endl;
@@ -189,7 +375,7 @@ public:
     }
     
     // Update harga kamar
-    bool updateHargaKamar(const string& nomor, double hargaBaru) {
+    bool updateHargaKamar(const string& nomor, const Rupiah& hargaBaru) {
         Kamar* kamar = cariKamar(nomor);
         
         if (kamar == nullptr) {
@@ -197,9 +383,10 @@ public:
             return false;
         }
         
-        double hargaLama = kamar->getHargaPerMalam();
+        Rupiah hargaLama = kamar->getHargaPerMalam();
         kamar->setHargaPerMalam(hargaBaru);
-        simpanDataKamar();
+        indexAtribut.perbarui(kamar);
+        tandaiBerubah(kamar);
         
         cout << "[SUKSES] Harga kamar " << nomor << " diubah dari " 
              << PengelolaFile::formatRupiah(hargaLama) << " menjadi " 
@@ -229,9 +416,18 @@ public:
         });
         
         if (berhasil) {
+            // Perubahan yang belum ditulis tidak perlu disimpan lagi
+            if (kamar->isPerluDisimpan()) {
+                antrianSimpan.hapus([&](Kamar* k) { return k == kamar; });
+            }
+            
+            string fields[1] = { nomor };
+            logKamar.tambahRecord("HAPUS", fields, 1);
+            
             delete kamar;
             indexKamar.hapus(nomor);
-            simpanDataKamar();
+            indexAtribut.hapus(nomor);
+            kalender.hapusKamar(nomor);
             cout << "[SUKSES] Kamar " << nomor << " berhasil dihapus!" << endl;
             return true;
         }
@@ -266,28 +462,19 @@ public:
     }
     
     // Tampilkan kamar tersedia saja
-    void tampilkanKamarTersedia() const {
+    void tampilkanKamarTersedia() {
         int jumlahTersedia = 0;
+        KriteriaKamar kriteria;
+        kriteria.pakaiStatus = true;
+        kriteria.status = StatusKamar::TERSEDIA;
         
         cout << "\n+------------------------------------------------------------+" << endl;
         cout << "          KAMAR TERSEDIA                                    " << endl;
         cout << "+------------------------------------------------------------+" << endl;
         
-        daftarKamar.iterasi([&](Kamar* k) {
-            if (k->getStatus() == StatusKamar::TERSEDIA) {
-                jumlahTersedia++;
-                cout << "\n[" << jumlahTersedia << "] " << k->getNomorKamar() 
-                     << " - " << k->getTipeString() << endl;
-                cout << "Harga/Malam : " << PengelolaFile::formatRupiahLengkap(k->getHargaPerMalam()) << endl;
-                cout << "Lantai " << k->getLantai() << " | Kapasitas " << k->getKapasitasOrang() << " orang";
-                if (k->hasBalkon()) cout << " | Balkon";
-                if (k->hasPemandanganLaut()) cout << " | View Laut";
-                cout << endl;
-                cout << "Fasilitas: " << k->getFasilitas().substr(0, 55);
-                if (k->getFasilitas().length() > 55) cout << "...";
-                cout << endl;
-                cout << "-----------------------------------------------------------" << endl;
-            }
+        indexAtribut.cari(kriteria, [&](Kamar* k) {
+            jumlahTersedia++;
+            tampilkanRingkasKamar(k, jumlahTersedia);
         });
         
         if (jumlahTersedia == 0) {
@@ -297,8 +484,68 @@ public:
         }
     }
     
+    // Tampilkan kamar yang kosong di semua malam check-in s/d check-out
+    // (berdasarkan kalender, kamar yang sedang PERBAIKAN tidak ditampilkan)
+    void tampilkanKamarKosong(const string& checkIn, const string& checkOut) {
+        int mulai, selesai;
+        if (!KalenderKamar::parseRentang(checkIn, checkOut, mulai, selesai)) {
+            cout << "[ERROR] Tanggal tidak valid! Format DD/MM/YYYY, check-out setelah check-in." << endl;
+            return;
+        }
+        
+        cout << "\n+------------------------------------------------------------+" << endl;
+        cout << "          KAMAR KOSONG " << checkIn << " - " << checkOut << "              " << endl;
+        cout << "+------------------------------------------------------------+" << endl;
+        
+        int jumlahKosong = 0;
+        kalender.iterasiKamarKosong(mulai, selesai, [&](const string& nomor) {
+            Kamar* k = cariKamar(nomor);
+            if (k == nullptr || k->getStatus() == StatusKamar::PERBAIKAN) return;
+            
+            jumlahKosong++;
+            cout << "[" << jumlahKosong << "] " << k->getNomorKamar() << " - " << k->getTipeString()
+                 << " | " << PengelolaFile::formatRupiahLengkap(k->getHargaPerMalam()) << "/malam" << endl;
+        });
+        
+        if (jumlahKosong == 0) {
+            cout << "\n[INFO] Tidak ada kamar kosong pada tanggal tersebut." << endl;
+        } else {
+            cout << "\nTotal: " << jumlahKosong << " kamar kosong (" << (selesai - mulai) << " malam)" << endl;
+        }
+    }
+    
+    // Tampilkan kamar yang memenuhi semua kriteria (lewat index bitmap)
+    void tampilkanKamarByKriteria(const KriteriaKamar& kriteria) {
+        cout << "\n+------------------------------------------------------------+" << endl;
+        cout << "          HASIL PENCARIAN KAMAR                             " << endl;
+        cout << "+------------------------------------------------------------+" << endl;
+        
+        int jumlah = 0;
+        indexAtribut.cari(kriteria, [&](Kamar* k) {
+            jumlah++;
+            tampilkanRingkasKamar(k, jumlah);
+        });
+        
+        if (jumlah == 0) {
+            cout << "\n[INFO] Tidak ada kamar yang sesuai kriteria." << endl;
+        } else {
+            cout << "\nTotal: " << jumlah << " kamar" << endl;
+        }
+    }
+    
+    // Hitung kamar by kriteria (scan kolom, tanpa membuka objek kamar)
+    int hitungKamarByKriteria(const KriteriaKamar& kriteria) const {
+        return indexAtribut.hitung(kriteria);
+    }
+    
+    // Cari kamar by kriteria, func(Kamar*) dipanggil untuk setiap kamar yang cocok
+    template<typename Function>
+    int cariKamarByKriteria(const KriteriaKamar& kriteria, Function func) {
+        return indexAtribut.cari(kriteria, func);
+    }
+    
     // Filter kamar by tipe
-    void tampilkanKamarByTipe(TipeKamar tipe) const {
+    void tampilkanKamarByTipe(TipeKamar tipe) {
         int jumlah = 0;
         
         cout << "\n+------------------------------------------------------------+" << endl;
@@ -315,13 +562,15 @@ public:
              << string(36 - judulTipe.length(), ' ') << "" << endl;
         cout << "+------------------------------------------------------------+" << endl;
         
-        daftarKamar.iterasi([&](Kamar* k) {
-            if (k->getTipe() == tipe) {
-                jumlah++;
-                cout << "\n" << k->getNomorKamar() << " - " << k->getStatusString() << endl;
-                cout << "Harga: " << PengelolaFile::formatRupiahLengkap(k->getHargaPerMalam()) 
-                     << " | Lantai " << k->getLantai() << endl;
-            }
+        KriteriaKamar kriteria;
+        kriteria.pakaiTipe = true;
+        kriteria.tipe = tipe;
+        
+        indexAtribut.cari(kriteria, [&](Kamar* k) {
+            jumlah++;
+            cout << "\n" << k->getNomorKamar() << " - " << k->getStatusString() << endl;
+            cout << "Harga: " << PengelolaFile::formatRupiahLengkap(k->getHargaPerMalam()) 
+                 << " | Lantai " << k->getLantai() << endl;
         });
         
         if (jumlah == 0) {
@@ -332,18 +581,15 @@ public:
     }
     
     // Get statistics
+    // Semua angka dari ringkasan yang dijaga incremental oleh index - O(1)
     void tampilkanStatistik() const {
-        int totalKamar = daftarKamar.ukuran();
-        int tersedia = 0, terisi = 0, perbaikan = 0, dibersihkan = 0;
+        const RingkasanKamar& ringkasan = indexAtribut.getRingkasan();
         
-        daftarKamar.iterasi([&](Kamar* k) {
-            switch (k->getStatus()) {
-                case StatusKamar::TERSEDIA: tersedia++; break;
-                case StatusKamar::TERISI: terisi++; break;
-                case StatusKamar::PERBAIKAN: perbaikan++; break;
-                case StatusKamar::DIBERSIHKAN: dibersihkan++; break;
-            }
-        });
+        int totalKamar = ringkasan.total;
+        int tersedia = ringkasan.perStatus[static_cast<int>(StatusKamar::TERSEDIA)];
+        int terisi = ringkasan.perStatus[static_cast<int>(StatusKamar::TERISI)];
+        int perbaikan = ringkasan.perStatus[static_cast<int>(StatusKamar::PERBAIKAN)];
+        int dibersihkan = ringkasan.perStatus[static_cast<int>(StatusKamar::DIBERSIHKAN)];
         
         cout << "\n+------------------------------------------------------------+" << endl;
         cout << "          STATISTIK KAMAR                                   " << endl;
@@ -359,11 +605,32 @@ public:
             double occupancy = (double)terisi / totalKamar * 100.0;
             cout << "  Occupancy Rate : " << (int)occupancy << "%" 
                  << string(37, ' ') << "" << endl;
+            
+            cout << "------------------------------------------------------------" << endl;
+            cout << "  Occupancy per Tipe                                        " << endl;
+            for (int t = 0; t < 4; t++) {
+                if (ringkasan.perTipe[t] == 0) continue;
+                tampilkanBarisOkupansi(Kamar::tipeKeString(static_cast<TipeKamar>(t)),
+                                       ringkasan.terisiPerTipe[t], ringkasan.perTipe[t]);
+            }
+            
+            cout << "  Occupancy per Lantai                                      " << endl;
+            for (int l = 0; l < RingkasanKamar::BATAS_LANTAI; l++) {
+                if (ringkasan.perLantai[l] == 0) continue;
+                string label = "Lantai " + to_string(l);
+                if (l == RingkasanKamar::BATAS_LANTAI - 1) label += "+";
+                tampilkanBarisOkupansi(label, ringkasan.terisiPerLantai[l], ringkasan.perLantai[l]);
+            }
         }
         
         cout << "+------------------------------------------------------------+" << endl;
     }
     
+    // Get kalender okupansi (diisi oleh SistemPembayaran)
+    KalenderKamar& getKalender() {
+        return kalender;
+    }
+    
     // Get daftar kamar (untuk keperluan lain)
     CircularLinkedList<Kamar*>& getDaftarKamar() {
         return daftarKamar;
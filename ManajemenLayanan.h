@@ -3,9 +3,12 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "CircularLinkedList.h"
-#include "BinarySearchTree.h"
+#include "IndeksKunci.h"
 #include "PengelolaFile.h"
+#include "LogPerubahan.h"
+#include "SnapshotBiner.h"
 #include "Layanan.h"
 using namespace std;
 
@@ -13,27 +16,126 @@ using namespace std;
 // MANAJEMEN LAYANAN - CRUD & SEARCH
 // ============================================================================
 // Mengelola semua layanan hotel: Ballroom, Restaurant, Laundry, dll
+// Penyimpanan sama seperti ManajemenKamar: layanan.txt (snapshot) +
+// layanan.log (delta, hanya layanan yang berubah)
 // ============================================================================
 
 class ManajemenLayanan {
 private:
     CircularLinkedList<Layanan*> daftarLayanan;
-    BinarySearchTree<Layanan*, string> indexLayanan; // BST untuk search by ID
+    IndeksKunci<Layanan*, string, StrukturIndeks::TERURUT> indexLayanan; // Index search by ID (lihat IndeksKunci.h)
     string namaFileLayanan;
+    LogPerubahan logLayanan;
+    CircularLinkedList<Layanan*> antrianSimpan; // Layanan dengan dirty flag aktif
+    int jumlahPerubahan;                        // Perubahan sejak flush terakhir
     int counterID;
     
-    // Helper: Rebuild BST index
+    static const int BATAS_PERUBAHAN = 16;
+    static const int BATAS_KOMPAKSI = 2000;
+    
+    // Helper: Buat objek layanan sesuai kategori (dipakai saat load)
+    static Layanan* buatLayanan(KategoriLayanan kategori, string id, string nama,
+                                const Rupiah& harga, SatuanHarga satuan, bool tersedia,
+                                int minOrder, string deskripsi) {
+        Layanan* layanan = nullptr;
+        
+        switch (kategori) {
+            case KategoriLayanan::BALLROOM:
+                layanan = new LayananBallroom(std::move(id), std::move(nama), harga, 500);
+                break;
+            case KategoriLayanan::RESTAURANT:
+                layanan = new LayananRestaurant(std::move(id), std::move(nama), harga);
+                break;
+            case KategoriLayanan::LAUNDRY:
+                layanan = new LayananLaundry(std::move(id), harga);
+                break;
+            case KategoriLayanan::KOLAM_RENANG:
+                layanan = new LayananKolamRenang(std::move(id), harga);
+                break;
+            case KategoriLayanan::GYM:
+                layanan = new LayananGym(std::move(id), harga);
+                break;
+            case KategoriLayanan::TRANSFER_BANDARA:
+                layanan = new LayananTransferBandara(std::move(id), harga);
+                break;
+            case KategoriLayanan::CATERING:
+                layanan = new LayananCatering(std::move(id), harga, "Paket Premium", minOrder);
+                break;
+            default:
+                layanan = new Layanan(std::move(id), std::move(nama), kategori, harga, satuan, "", minOrder);
+                break;
+        }
+        
+        layanan->setTersedia(tersedia);
+        layanan->setDeskripsi(std::move(deskripsi));
+        layanan->setMinimumOrder(minOrder);
+        
+        return layanan;
+    }
+    
+    // Helper: Buat layanan dari field baris file, nullptr jika tidak valid
+    static Layanan* parseLayanan(const PotonganString fields[], int fieldCount) {
+        if (fieldCount < 8) return nullptr;
+        
+        Rupiah harga;
+        int minOrder;
+        if (!PengelolaFile::parseRupiah(fields[3], harga) ||
+            !PengelolaFile::parseInt(fields[6], minOrder)) {
+            return nullptr; // Skip baris dengan angka tidak valid
+        }
+        
+        KategoriLayanan kategori = Layanan::stringKeKategori(fields[0].toString());
+        SatuanHarga satuan = Layanan::stringKeSatuan(fields[4].toString());
+        bool tersedia = (fields[5] == "1");
+        
+        return buatLayanan(kategori, fields[1].toString(), fields[2].toString(), harga,
+                           satuan, tersedia, minOrder, fields[7].toString());
+    }
+    
+    // Helper: Tandai layanan berubah, flush ke log setiap BATAS_PERUBAHAN perubahan
+    void tandaiBerubah(Layanan* layanan) {
+        if (!layanan->isPerluDisimpan()) {
+            layanan->setPerluDisimpan(true);
+            antrianSimpan.tambah(layanan);
+        }
+        
+        if (++jumlahPerubahan >= BATAS_PERUBAHAN) {
+            simpanPerubahan();
+        }
+    }
+    
+    // Helper: Track max ID untuk auto-increment
+    void catatId(const PotonganString& id) {
+        int num;
+        if (id.mulaiDengan("L") && PengelolaFile::parseInt(id.dari(1), num)) {
+            if (num >= counterID) counterID = num + 1;
+        }
+    }
+    
+    // Helper: Rebuild index (bulk build, bukan insert satu per satu)
     void rebuildIndex() {
-        indexLayanan.clear();
+        int jumlah = daftarLayanan.ukuran();
+        Layanan** data = new Layanan*[jumlah];
+        string* kunci = new string[jumlah];
+        
+        int i = 0;
         daftarLayanan.iterasi([&](Layanan* l) {
-            indexLayanan.insert(l, l->getIdLayanan());
+            data[i] = l;
+            kunci[i] = l->getIdLayanan();
+            i++;
         });
+        
+        indexLayanan.bangunDariTerurut(data, kunci, jumlah);
+        
+        delete[] data;
+        delete[] kunci;
     }
 
 public:
     // Constructor
     ManajemenLayanan(const string& namaFile = "layanan.txt") 
-        : namaFileLayanan(namaFile), counterID(1) {
+        : namaFileLayanan(namaFile), logLayanan(PengelolaFile::gantiEkstensi(namaFile, ".log")),
+          jumlahPerubahan(0), counterID(1) {
         PengelolaFile::buatFileJikaBelumAda(namaFileLayanan);
     }
     
@@ -44,105 +146,161 @@ public:
         });
     }
     
-    // Load data layanan dari file
+    // Load data layanan dari snapshot, lalu putar ulang log
     bool muatDataLayanan() {
-        string baris[1000];
-        int jumlah = PengelolaFile::bacaSemuaBaris(namaFileLayanan, baris, 1000);
-        
-        if (jumlah == 0) {
-            cout << "[INFO] File layanan kosong. Membuat data default..." << endl;
-            return false;
-        }
-        
-        int maxIdNum = 0;
-        
-        for (int i = 0; i < jumlah; i++) {
-            string fields[10];
+        PengelolaFile::bacaPerBaris(namaFileLayanan, [&](const string& baris) {
+            PotonganString fields[10];
             int fieldCount;
-            PengelolaFile::split(baris[i], '|', fields, fieldCount);
-            
-            if (fieldCount < 8) continue;
-            
-            string kategoriStr = fields[0];
-            string id = fields[1];
-            string nama = fields[2];
-            double harga = stod(fields[3]);
-            string satuanStr = fields[4];
-            bool tersedia = (fields[5] == "1");
-            int minOrder = stoi(fields[6]);
-            string deskripsi = fields[7];
-            
-            KategoriLayanan kategori = Layanan::stringKeKategori(kategoriStr);
-            SatuanHarga satuan = Layanan::stringKeSatuan(satuanStr);
-            
-            Layanan* layanan = nullptr;
-            
-            // Buat layanan sesuai kategori
-            switch (kategori) {
-                case KategoriLayanan::BALLROOM:
-                    layanan = new LayananBallroom(id, nama, harga, 500);
-                    break;
-                case KategoriLayanan::RESTAURANT:
-                    layanan = new LayananRestaurant(id, nama, harga);
-                    break;
-                case KategoriLayanan::LAUNDRY:
-                    layanan = new LayananLaundry(id, harga);
-                    break;
-                case KategoriLayanan::KOLAM_RENANG:
-                    layanan = new LayananKolamRenang(id, harga);
-                    break;
-                case KategoriLayanan::GYM:
-                    layanan = new LayananGym(id, harga);
-                    break;
-                case KategoriLayanan::TRANSFER_BANDARA:
-                    layanan = new LayananTransferBandara(id, harga);
-                    break;
-                case KategoriLayanan::CATERING:
-                    layanan = new LayananCatering(id, harga, "Paket Premium", minOrder);
-                    break;
-                default:
-                    layanan = new Layanan(id, nama, kategori, harga, satuan, deskripsi, minOrder);
-                    break;
-            }
+            PengelolaFile::splitPotongan(baris, '|', fields, 10, fieldCount);
             
+            Layanan* layanan = parseLayanan(fields, fieldCount);
             if (layanan != nullptr) {
-                layanan->setTersedia(tersedia);
-                layanan->setDeskripsi(deskripsi);
-                layanan->setMinimumOrder(minOrder);
                 daftarLayanan.tambah(layanan);
+                catatId(fields[1]);
+            }
+        });
+        
+        // Build index untuk search (dipakai juga saat replay log)
+        rebuildIndex();
+        
+        // LAYANAN|<baris layanan> = tambah/ganti, HAPUS|<id> = hapus
+        logLayanan.putarUlang([&](const PotonganString fields[], int fieldCount) {
+            if (fields[0] == "LAYANAN") {
+                Layanan* baru = parseLayanan(fields + 1, fieldCount - 1);
+                if (baru == nullptr) return;
                 
-                // Track max ID
-                if (id[0] == 'L' && id.length() > 1) {
-                    int num = stoi(id.substr(1));
-                    if (num > maxIdNum) maxIdNum = num;
+                Layanan* lama = cariLayanan(baru->getIdLayanan());
+                if (lama != nullptr) {
+                    // Harga & ketersediaan yang bisa berubah setelah layanan dibuat
+                    lama->setHarga(baru->getHarga());
+                    lama->setTersedia(baru->isTersedia());
+                    delete baru;
+                } else {
+                    daftarLayanan.tambah(baru);
+                    indexLayanan.insert(baru, baru->getIdLayanan());
+                    catatId(fields[2]);
                 }
+            } else if (fields[0] == "HAPUS" && fieldCount >= 2) {
+                string id = fields[1].toString();
+                Layanan* layanan = cariLayanan(id);
+                if (layanan == nullptr) return;
+                
+                daftarLayanan.hapus([&](Layanan* l) { return l == layanan; });
+                indexLayanan.hapus(id);
+                delete layanan;
             }
+        });
+        
+        if (daftarLayanan.kosong()) {
+            PengelolaFile::cetakBaris("[INFO] File layanan kosong. Membuat data default...");
+            return false;
+        }
+        
+        PengelolaFile::cetakBaris("[SUKSES] Berhasil memuat " + to_string(daftarLayanan.ukuran()) + " layanan");
+        return true;
+    }
+    
+    // Byte per record layanan di snapshot biner
+    static const size_t LEBAR_RECORD_SNAPSHOT = 3 * sizeof(uint8_t) + sizeof(int32_t) +
+                                                sizeof(int64_t) + 3 * sizeof(uint32_t);
+    
+    // Tulis semua layanan ke snapshot biner
+    // Record: kategori, satuan, tersedia, minOrder, harga, id, nama, deskripsi
+    void tulisSnapshot(PenulisSnapshot& snapshot) const {
+        snapshot.setJumlahData(BagianSnapshot::LAYANAN, daftarLayanan.ukuran());
+        
+        daftarLayanan.iterasi([&](Layanan* l) {
+            snapshot.tulis<uint8_t>(static_cast<uint8_t>(l->getKategori()));
+            snapshot.tulis<uint8_t>(static_cast<uint8_t>(l->getSatuan()));
+            snapshot.tulis<uint8_t>(l->isTersedia() ? 1 : 0);
+            snapshot.tulis<int32_t>(l->getMinimumOrder());
+            snapshot.tulis<int64_t>(l->getHarga().getSen());
+            snapshot.tulisString(l->getIdLayanan());
+            snapshot.tulisString(l->getNamaLayanan());
+            snapshot.tulisString(l->getDeskripsi());
+        });
+    }
+    
+    // Load layanan dari snapshot biner (sudah divalidasi oleh PembacaSnapshot)
+    bool muatSnapshot(PembacaSnapshot& snapshot) {
+        uint32_t jumlah = snapshot.getJumlahData(BagianSnapshot::LAYANAN);
+        
+        // Layanan dikumpulkan dulu, lalu disambung ke list sekaligus
+        Layanan** hasil = new Layanan*[jumlah];
+        
+        for (uint32_t i = 0; i < jumlah; i++) {
+            KategoriLayanan kategori = static_cast<KategoriLayanan>(snapshot.baca<uint8_t>());
+            SatuanHarga satuan = static_cast<SatuanHarga>(snapshot.baca<uint8_t>());
+            bool tersedia = snapshot.baca<uint8_t>() != 0;
+            int minOrder = snapshot.baca<int32_t>();
+            Rupiah harga = Rupiah::dariSen(snapshot.baca<int64_t>());
+            const string& id = snapshot.bacaString();
+            const string& nama = snapshot.bacaString();
+            const string& deskripsi = snapshot.bacaString();
+            
+            hasil[i] = buatLayanan(kategori, id, nama, harga, satuan,
+                                   tersedia, minOrder, deskripsi);
+            catatId(PotonganString(id));
         }
         
-        counterID = maxIdNum + 1;
+        daftarLayanan.tambahBanyak(hasil, hasil + jumlah);
+        delete[] hasil;
+        
         rebuildIndex();
         
-        cout << "[SUKSES] Berhasil memuat " << daftarLayanan.ukuran() << " layanan" << endl;
-        return true;
+        if (daftarLayanan.kosong()) return false;
+        
+        PengelolaFile::cetakBaris("[SUKSES] Berhasil memuat " + to_string(daftarLayanan.ukuran()) + " layanan");
+        return !snapshot.gagal();
     }
     
-    // Simpan semua layanan ke file
+    // Simpan semua layanan ke file snapshot & kosongkan log (kompaksi)
+    // Dipanggil saat keluar program atau log sudah terlalu panjang
     bool simpanDataLayanan() {
-        string baris[1000];
-        int jumlah = 0;
+        bool berhasil = PengelolaFile::tulisPerBaris(namaFileLayanan, [&](PenulisFile& penulis) {
+            daftarLayanan.iterasi([&](Layanan* l) {
+                penulis.tulisBaris(l->toFileFormat());
+            });
+        });
         
-        daftarLayanan.iterasi([&](Layanan* l) {
-            if (jumlah < 1000) {
-                baris[jumlah++] = l->toFileFormat();
-            }
+        if (!berhasil) return false;
+        
+        antrianSimpan.iterasi([](Layanan* l) {
+            l->setPerluDisimpan(false);
         });
+        antrianSimpan.clear();
+        jumlahPerubahan = 0;
         
-        return PengelolaFile::tulisSemuaBaris(namaFileLayanan, baris, jumlah);
+        return logLayanan.kosongkan();
+    }
+    
+    // Kosongkan log tanpa menulis snapshot (untuk reset data)
+    bool kosongkanLog() {
+        return logLayanan.kosongkan();
+    }
+    
+    // Tulis layanan yang berubah saja ke log (1 record per layanan)
+    bool simpanPerubahan() {
+        bool berhasil = true;
+        string fields[1];
+        
+        antrianSimpan.iterasi([&](Layanan* l) {
+            fields[0] = l->toFileFormat();
+            if (!logLayanan.tambahRecord("LAYANAN", fields, 1)) berhasil = false;
+            l->setPerluDisimpan(false);
+        });
+        antrianSimpan.clear();
+        jumlahPerubahan = 0;
+        
+        if (berhasil && logLayanan.getJumlahRecord() >= BATAS_KOMPAKSI) {
+            return simpanDataLayanan();
+        }
+        return berhasil && logLayanan.sinkronkan();
     }
     
     // Tambah layanan baru (generic)
     bool tambahLayanan(KategoriLayanan kategori, const string& nama, 
-                      double harga, int minOrder = 1, 
+                      const Rupiah& harga, int minOrder = 1, 
                       const string& deskripsi = "") {
         
         string id = "L" + PengelolaFile::generateID("", counterID++);
@@ -189,14 +347,14 @@ public:
         
         daftarLayanan.tambah(layananBaru);
         indexLayanan.insert(layananBaru, id);
-        simpanDataLayanan();
+        tandaiBerubah(layananBaru);
         
         cout << "[SUKSES] Layanan " << nama << " (ID: " << id << ") berhasil ditambahkan!" << endl;
         
         return true;
     }
     
-    // Cari layanan by ID (menggunakan BST - O(log n))
+    // Cari layanan by ID (binary search di index - O(log n))
     Layanan* cariLayanan(const string& id) {
         Layanan** found = indexLayanan.search(id);
         if (found != nullptr) {
@@ -206,7 +364,7 @@ public:
     }
     
     // Update harga layanan
-    bool updateHargaLayanan(const string& id, double hargaBaru) {
+    bool updateHargaLayanan(const string& id, const Rupiah& hargaBaru) {
         Layanan* layanan = cariLayanan(id);
         
         if (layanan == nullptr) {
@@ -214,9 +372,9 @@ public:
             return false;
         }
         
-        double hargaLama = layanan->getHarga();
+        Rupiah hargaLama = layanan->getHarga();
         layanan->setHarga(hargaBaru);
-        simpanDataLayanan();
+        tandaiBerubah(layanan);
         
         cout << "[SUKSES] Harga " << layanan->getNamaLayanan() << " diubah dari " 
              << PengelolaFile::formatRupiah(hargaLama) << " menjadi " 
@@ -235,7 +393,7 @@ public:
         }
         
         layanan->setTersedia(tersedia);
-        simpanDataLayanan();
+        tandaiBerubah(layanan);
         
         cout << "[SUKSES] Layanan " << layanan->getNamaLayanan() 
              << " diubah menjadi: " << (tersedia ? "Tersedia" : "Tidak Tersedia") << endl;
@@ -259,9 +417,16 @@ public:
         });
         
         if (berhasil) {
+            // Perubahan yang belum ditulis tidak perlu disimpan lagi
+            if (layanan->isPerluDisimpan()) {
+                antrianSimpan.hapus([&](Layanan* l) { return l == layanan; });
+            }
+            
+            string fields[1] = { id };
+            logLayanan.tambahRecord("HAPUS", fields, 1);
+            
             delete layanan;
             indexLayanan.hapus(id);
-            simpanDataLayanan();
             cout << "[SUKSES] Layanan " << nama << " berhasil dihapus!" << endl;
             return true;
         }
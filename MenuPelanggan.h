@@ -21,7 +21,7 @@ private:
 public:
     MenuPelanggan(Pelanggan* p, ManajemenKamar* mk, ManajemenLayanan* ml, SistemPembayaran* sp, SistemAutentikasi* auth)
         : pelanggan(p), manajemenKamar(mk), manajemenLayanan(ml), sistemPembayaran(sp) {
-        keranjang = new KeranjangBelanja(p->getId(), p->getNama());
+        keranjang = new KeranjangBelanja(p->getId(), p->getNama(), &mk->getKalender());
         editProfil = new EditProfil(auth);
     }
     
@@ -42,6 +42,8 @@ public:
             cout << "  4. Checkout & Bayar                                       \n";
             cout << "  5. Riwayat Transaksi Saya                                 \n";
             cout << "  6. Edit Profil Saya                                       \n";
+            cout << "  7. Cari Kamar Kosong (Tanggal)                            \n";
+            cout << "  8. Cari Kamar (Tipe/Lantai/Kapasitas/Harga)               \n";
             cout << "  0. Logout                                                 \n";
             cout << "+------------------------------------------------------------+\n";
             cout << "Keranjang: " << keranjang->getInfoRingkas() << endl;
@@ -54,6 +56,8 @@ public:
                 case 4: prosesCheckout(); break;
                 case 5: sistemPembayaran->tampilkanTransaksiCustomer(pelanggan->getId()); break;
                 case 6: editProfil->menuEditProfilPelanggan(pelanggan); break;
+                case 7: menuCariKamarKosong(); break;
+                case 8: menuCariKamar(); break;
                 case 0: cout << "\n[INFO] Logout berhasil!\n"; break;
                 default: cout << "[ERROR] Pilihan tidak valid!\n";
             }
@@ -68,14 +72,57 @@ private:
             cout << "Nomor kamar: "; string nomor; getline(cin, nomor);
             Kamar* k = manajemenKamar->cariKamar(nomor);
             if(k) {
-                cout << "Jumlah malam: "; int malam; cin >> malam; cin.ignore();
                 cout << "Check-in (DD/MM/YYYY): "; string checkin; getline(cin, checkin);
                 cout << "Check-out (DD/MM/YYYY): "; string checkout; getline(cin, checkout);
-                keranjang->tambahKamar(k, malam, checkin, checkout);
+                sistemPembayaran->siapkanKalender();
+                keranjang->tambahKamar(k, checkin, checkout);
             }
         }
     }
     
+    void menuCariKamarKosong() {
+        cout << "Check-in (DD/MM/YYYY): "; string checkin; getline(cin, checkin);
+        cout << "Check-out (DD/MM/YYYY): "; string checkout; getline(cin, checkout);
+        sistemPembayaran->siapkanKalender();
+        manajemenKamar->tampilkanKamarKosong(checkin, checkout);
+    }
+    
+    void menuCariKamar() {
+        KriteriaKamar kriteria;
+        kriteria.pakaiStatus = true;
+        kriteria.status = StatusKamar::TERSEDIA;
+        
+        cout << "Tipe (1. Standard 2. Deluxe 3. Suite 4. Presidential, 0 = semua): ";
+        int tipe; cin >> tipe;
+        if(tipe >= 1 && tipe <= 4) {
+            kriteria.pakaiTipe = true;
+            kriteria.tipe = static_cast<TipeKamar>(tipe - 1);
+        }
+        
+        cout << "Lantai minimal (0 = bebas): "; int lantaiMin; cin >> lantaiMin;
+        cout << "Lantai maksimal (0 = bebas): "; int lantaiMaks; cin >> lantaiMaks;
+        if(lantaiMin > 0 || lantaiMaks > 0) {
+            kriteria.pakaiLantai = true;
+            kriteria.lantaiMin = lantaiMin;
+            kriteria.lantaiMaks = (lantaiMaks > 0) ? lantaiMaks : 1000000;
+        }
+        
+        cout << "Kapasitas minimal (orang, 0 = bebas): "; cin >> kriteria.kapasitasMin;
+        cout << "Harga maksimal per malam (0 = bebas): "; double hargaMaks; cin >> hargaMaks;
+        if(hargaMaks > 0) {
+            kriteria.pakaiHarga = true;
+            kriteria.hargaMaks = Rupiah::dariDouble(hargaMaks);
+        }
+        cin.ignore();
+        
+        cout << "Harus ada balkon? (y/n): "; string jawab; getline(cin, jawab);
+        kriteria.harusBalkon = (jawab == "y" || jawab == "Y");
+        cout << "Harus pemandangan laut? (y/n): "; getline(cin, jawab);
+        kriteria.harusPemandanganLaut = (jawab == "y" || jawab == "Y");
+        
+        manajemenKamar->tampilkanKamarByKriteria(kriteria);
+    }
+    
     void menuKatalogLayanan() {
         manajemenLayanan->tampilkanLayananTersedia();
         cout << "\nTambah ke keranjang? (y/n): "; string jawab; getline(cin, jawab);
@@ -127,10 +174,15 @@ private:
         else if(metode == 3) metodeBayar = MetodePembayaran::KARTU_KREDIT;
         else if(metode == 4) metodeBayar = MetodePembayaran::EWALLET;
         
+        // Item dipindah ke transaksi; jika pembayaran gagal (misal kamar
+        // bentrok) item dikembalikan ke keranjang dan transaksi dibuang
         Transaksi* t = keranjang->checkout("03/01/2026");
-        if(t && sistemPembayaran->prosesPembayaran(t, metodeBayar)) {
+        if(t == nullptr) return;
+        if(sistemPembayaran->prosesPembayaran(t, metodeBayar)) {
             sistemPembayaran->generateStruk(t);
             keranjang->kosongkan();
+        } else {
+            keranjang->batalCheckout(t);
         }
     }
 };
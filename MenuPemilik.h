@@ -88,7 +88,7 @@ private:
         } else if(p==4) {
             cout << "Nomor: "; string no; getline(cin, no);
             cout << "Harga baru: "; double h; cin >> h; cin.ignore();
-            manajemenKamar->updateHargaKamar(no, h);
+            manajemenKamar->updateHargaKamar(no, Rupiah::dariDouble(h));
         }
     }
     
@@ -103,14 +103,14 @@ private:
             cout << "Nama: "; string nama; getline(cin, nama);
             cout << "Kategori (0-6): "; int k; cin >> k; cin.ignore();
             cout << "Harga: "; double h; cin >> h; cin.ignore();
-            manajemenLayanan->tambahLayanan((KategoriLayanan)k, nama, h);
+            manajemenLayanan->tambahLayanan((KategoriLayanan)k, nama, Rupiah::dariDouble(h));
         } else if(p==3) {
             cout << "ID Layanan: "; string id; getline(cin, id);
             manajemenLayanan->hapusLayanan(id);
         } else if(p==4) {
             cout << "ID: "; string id; getline(cin, id);
             cout << "Harga baru: "; double h; cin >> h; cin.ignore();
-            manajemenLayanan->updateHargaLayanan(id, h);
+            manajemenLayanan->updateHargaLayanan(id, Rupiah::dariDouble(h));
         }
     }
     
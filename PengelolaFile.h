@@ -5,6 +5,30 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <thread>
+#include <mutex>
+#include <exception>
+#include <system_error>
+#include "PotonganString.h"
+#include "Rupiah.h"
+
+// Memory-mapped file hanya tersedia di sistem POSIX (Linux/macOS),
+// di platform lain bacaPerBaris memakai fread + buffer
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define PENGELOLA_FILE_MMAP
+#endif
+
+#ifdef _WIN32
+#include <io.h>
+#endif
+
 using namespace std;
 
 // ============================================================================
@@ -12,13 +36,194 @@ using namespace std;
 // ============================================================================
 // Format file: Setiap baris adalah 1 record, field dipisah dengan delimiter
 // Contoh: PELANGGAN|P001|Budi|budi@email.com|081234567890|password123
+// Baca/tulis lewat buffer besar tanpa batas jumlah record
+// ============================================================================
+
+// Ukuran buffer baca/tulis file (1 MB)
+const int UKURAN_BUFFER_FILE = 1 << 20;
+
+// Ukuran minimum satu bagian saat file dibaca paralel (1 MB)
+const size_t UKURAN_MIN_BAGIAN_PARALEL = 1 << 20;
+
+// Kebijakan fsync saat PenulisFile ditutup
+enum class KebijakanSinkron {
+    TANPA,        // Serahkan ke OS: paling cepat, isi bisa hilang jika OS crash
+    SAAT_TUTUP    // Satu fsync sebelum file dipindah ke nama tujuan (default)
+};
+
+// Opsi penulisan file
+struct OpsiTulis {
+    size_t ukuranBuffer;
+    KebijakanSinkron sinkron;
+    
+    OpsiTulis(size_t _ukuranBuffer = UKURAN_BUFFER_FILE,
+              KebijakanSinkron _sinkron = KebijakanSinkron::SAAT_TUTUP)
+        : ukuranBuffer(_ukuranBuffer), sinkron(_sinkron) {}
+};
+
+// ============================================================================
+// PENULIS FILE - BUFFERED ATOMIC WRITER
+// ============================================================================
+// Baris dikumpulkan di buffer dan ditulis per blok (bukan flush per baris)
+// Mode overwrite: isi ditulis ke <nama>.tmp, lalu saat tutup() di-fsync dan
+// di-rename menimpa file tujuan. Jika program crash di tengah penulisan,
+// file tujuan tetap berisi versi lama yang utuh (tidak pernah terpotong)
+// Contoh: PenulisFile penulis("kamar.txt"); penulis.tulisBaris(...); penulis.tutup();
 // ============================================================================
 
+class PenulisFile {
+private:
+    FILE* file;
+    char* buffer;
+    size_t terisi;
+    bool gagal;
+    string namaTujuan;
+    string namaSementara;   // Kosong untuk mode append
+    OpsiTulis opsi;
+    
+    // Helper: Tulis isi buffer ke file
+    void kosongkanBuffer() {
+        if (terisi > 0 && fwrite(buffer, 1, terisi, file) != terisi) {
+            gagal = true;
+        }
+        terisi = 0;
+    }
+    
+    // Helper: fsync folder berisi file agar rename ikut tersimpan (POSIX)
+    static void sinkronkanFolder(const string& namaFile) {
+#ifdef PENGELOLA_FILE_MMAP
+        size_t posisi = namaFile.find_last_of('/');
+        string folder = (posisi == string::npos) ? "." : namaFile.substr(0, posisi + 1);
+        
+        int fd = open(folder.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            fsync(fd);
+            close(fd);
+        }
+#else
+        (void)namaFile;
+#endif
+    }
+    
+    // Helper: Pindahkan file sementara menimpa file tujuan
+    static bool gantiFile(const string& sumber, const string& tujuan) {
+#ifdef _WIN32
+        // rename() di Windows gagal jika tujuan sudah ada
+        remove(tujuan.c_str());
+#endif
+        return rename(sumber.c_str(), tujuan.c_str()) == 0;
+    }
+
+public:
+    // Paksa isi file yang sudah ditulis benar-benar tersimpan ke disk
+    // (fflush ke OS, lalu fsync/_commit ke storage)
+    static bool sinkronkan(FILE* file) {
+        if (file == nullptr || fflush(file) != 0) return false;
+
+#if defined(PENGELOLA_FILE_MMAP)
+        return fsync(fileno(file)) == 0;
+#elif defined(_WIN32)
+        return _commit(_fileno(file)) == 0;
+#else
+        return true;
+#endif
+    }
+    
+    // Constructor - append = true untuk menambah di akhir file (tanpa file sementara)
+    PenulisFile(const string& namaFile, bool append = false, const OpsiTulis& _opsi = OpsiTulis())
+        : file(nullptr), buffer(nullptr), terisi(0), gagal(false),
+          namaTujuan(namaFile), opsi(_opsi) {
+        if (opsi.ukuranBuffer == 0) opsi.ukuranBuffer = UKURAN_BUFFER_FILE;
+        
+        if (append) {
+            file = fopen(namaFile.c_str(), "a");
+        } else {
+            namaSementara = namaFile + ".tmp";
+            file = fopen(namaSementara.c_str(), "w");
+        }
+        
+        if (file != nullptr) {
+            buffer = new char[opsi.ukuranBuffer];
+        }
+    }
+    
+    // Destructor - sisa buffer tetap ditulis
+    ~PenulisFile() {
+        tutup();
+    }
+    
+    PenulisFile(const PenulisFile&) = delete;
+    PenulisFile& operator=(const PenulisFile&) = delete;
+    
+    bool terbuka() const { return file != nullptr; }
+    
+    // Tulis satu baris (newline ditambahkan otomatis)
+    void tulisBaris(const string& baris) {
+        if (file == nullptr) return;
+        
+        size_t panjang = baris.length();
+        
+        // Baris lebih besar dari buffer: tulis langsung
+        if (panjang + 1 > opsi.ukuranBuffer) {
+            kosongkanBuffer();
+            if (fwrite(baris.data(), 1, panjang, file) != panjang) gagal = true;
+            if (fputc('\n', file) == EOF) gagal = true;
+            return;
+        }
+        
+        if (terisi + panjang + 1 > opsi.ukuranBuffer) {
+            kosongkanBuffer();
+        }
+        
+        memcpy(buffer + terisi, baris.data(), panjang);
+        terisi += panjang;
+        buffer[terisi++] = '\n';
+    }
+    
+    // Tulis sisa buffer & tutup file, return false jika ada penulisan gagal
+    // Mode overwrite: file tujuan baru diganti jika semua penulisan berhasil,
+    // jika gagal file sementara dibuang dan file tujuan tidak berubah
+    bool tutup() {
+        if (file == nullptr) return false;
+        
+        kosongkanBuffer();
+        if (!gagal && opsi.sinkron == KebijakanSinkron::SAAT_TUTUP && !sinkronkan(file)) {
+            gagal = true;
+        }
+        if (fclose(file) != 0) gagal = true;
+        file = nullptr;
+        
+        delete[] buffer;
+        buffer = nullptr;
+        
+        if (!namaSementara.empty()) {
+            if (gagal || !gantiFile(namaSementara, namaTujuan)) {
+                remove(namaSementara.c_str());
+                return false;
+            }
+            
+            if (opsi.sinkron == KebijakanSinkron::SAAT_TUTUP) {
+                sinkronkanFolder(namaTujuan);
+            }
+        }
+        
+        return !gagal;
+    }
+};
+
 class PengelolaFile {
 public:
     // Delimiter default untuk pemisah field
     static const char DELIMITER = '|';
     
+    // Cetak satu pesan ke console (aman dipanggil dari beberapa thread,
+    // pesan tidak akan tercampur dengan pesan thread lain)
+    static void cetakBaris(const string& pesan) {
+        static mutex kunciConsole;
+        lock_guard<mutex> kunci(kunciConsole);
+        cout << pesan << endl;
+    }
+    
     // Helper: Trim whitespace dari string
     static string trim(const string& str) {
         size_t first = str.find_first_not_of(" \t\n\r");
@@ -28,15 +233,148 @@ public:
         return str.substr(first, (last - first + 1));
     }
     
-    // Helper: Split string berdasarkan delimiter
-    static void split(const string& str, char delim, string hasil[], int& jumlah) {
-        stringstream ss(str);
-        string item;
+    // Helper: Cek karakter whitespace (untuk trim)
+    static bool isSpasi(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+    
+    // Helper: Trim whitespace tanpa alokasi
+    static PotonganString trimPotongan(PotonganString teks) {
+        size_t first = 0;
+        while (first < teks.panjang && isSpasi(teks.data[first])) first++;
+        
+        size_t last = teks.panjang;
+        while (last > first && isSpasi(teks.data[last - 1])) last--;
+        
+        return PotonganString(teks.data + first, last - first);
+    }
+    
+    // Split string berdasarkan delimiter tanpa alokasi
+    // hasil[] berisi potongan (sudah di-trim) yang menunjuk ke str
+    // Maksimal 'maksimal' field, sisanya diabaikan
+    // Delimiter di akhir baris tidak menghasilkan field kosong
+    static void splitPotongan(const string& str, char delim, PotonganString hasil[],
+                              int maksimal, int& jumlah) {
+        const char* awal = str.data();
+        const char* akhir = awal + str.length();
         jumlah = 0;
         
-        while (getline(ss, item, delim)) {
-            hasil[jumlah++] = trim(item);
+        while (awal < akhir && jumlah < maksimal) {
+            const char* pemisah = static_cast<const char*>(memchr(awal, delim, akhir - awal));
+            if (pemisah == nullptr) pemisah = akhir;
+            
+            hasil[jumlah++] = trimPotongan(PotonganString(awal, pemisah - awal));
+            awal = pemisah + 1;
+        }
+    }
+    
+    // Parse bilangan bulat (long long) dari potongan, false jika tidak valid
+    static bool parseLongLong(PotonganString teks, long long& hasil) {
+        size_t i = 0;
+        bool negatif = false;
+        
+        if (i < teks.panjang && (teks[i] == '-' || teks[i] == '+')) {
+            negatif = (teks[i] == '-');
+            i++;
+        }
+        
+        if (i >= teks.panjang || teks.panjang - i > 18) return false;
+        
+        long long nilai = 0;
+        for (; i < teks.panjang; i++) {
+            if (teks[i] < '0' || teks[i] > '9') return false;
+            nilai = nilai * 10 + (teks[i] - '0');
+        }
+        
+        hasil = negatif ? -nilai : nilai;
+        return true;
+    }
+    
+    // Parse int dari potongan, false jika tidak valid
+    static bool parseInt(PotonganString teks, int& hasil) {
+        long long nilai;
+        if (!parseLongLong(teks, nilai) || nilai > 2147483647LL || nilai < -2147483647LL - 1) {
+            return false;
+        }
+        
+        hasil = static_cast<int>(nilai);
+        return true;
+    }
+    
+    // Parse nominal Rupiah dari potongan ("1955000" atau "1419752.05"),
+    // false jika tidak valid. Lebih dari 2 digit desimal dibulatkan ke sen
+    static bool parseRupiah(PotonganString teks, Rupiah& hasil) {
+        long long rupiah;
+        const char* titik = static_cast<const char*>(memchr(teks.data, '.', teks.panjang));
+        
+        if (titik == nullptr) {
+            if (!parseLongLong(teks, rupiah)) return false;
+            hasil = Rupiah::dariRupiah(rupiah);
+            return true;
+        }
+        
+        size_t posisi = titik - teks.data;
+        PotonganString bagianSen = teks.dari(posisi + 1);
+        int sen;
+        
+        if (bagianSen.panjang >= 1 && bagianSen.panjang <= 2 && bagianSen[0] != '-' &&
+            bagianSen[0] != '+' && parseLongLong(PotonganString(teks.data, posisi), rupiah) &&
+            parseInt(bagianSen, sen)) {
+            if (bagianSen.panjang == 1) sen *= 10;
+            
+            int64_t totalSen = (int64_t)rupiah * Rupiah::SEN_PER_RUPIAH;
+            hasil = Rupiah::dariSen(teks[0] == '-' ? totalSen - sen : totalSen + sen);
+            return true;
+        }
+        
+        double nominal;
+        if (!parseDouble(teks, nominal)) return false;
+        hasil = Rupiah::dariDouble(nominal);
+        return true;
+    }
+    
+    // Parse double dari potongan, false jika tidak valid
+    // Angka bulat (kasus umum: harga/total) dihitung langsung,
+    // selain itu pakai strtod dari buffer lokal (tetap tanpa alokasi heap)
+    static bool parseDouble(PotonganString teks, double& hasil) {
+        long long bulat;
+        if (parseLongLong(teks, bulat)) {
+            hasil = static_cast<double>(bulat);
+            return true;
+        }
+        
+        char buffer[64];
+        if (teks.panjang == 0 || teks.panjang >= sizeof(buffer)) return false;
+        
+        memcpy(buffer, teks.data, teks.panjang);
+        buffer[teks.panjang] = '\0';
+        
+        char* akhir = nullptr;
+        hasil = strtod(buffer, &akhir);
+        return akhir == buffer + teks.panjang;
+    }
+    
+    // Helper: Ganti ekstensi nama file (kamar.txt -> kamar.log)
+    static string gantiEkstensi(const string& namaFile, const string& ekstensiBaru) {
+        size_t titik = namaFile.rfind('.');
+        if (titik == string::npos) return namaFile + ekstensiBaru;
+        return namaFile.substr(0, titik) + ekstensiBaru;
+    }
+    
+    // Helper: Ukuran & waktu ubah terakhir file dalam nanodetik (-1 jika tidak ada)
+    static void infoFile(const string& namaFile, long long& ukuran, long long& waktuUbah) {
+        struct stat info;
+        if (stat(namaFile.c_str(), &info) != 0) {
+            ukuran = -1;
+            waktuUbah = -1;
+            return;
         }
+        
+        ukuran = (long long)info.st_size;
+        waktuUbah = (long long)info.st_mtime * 1000000000LL;
+#if defined(__linux__)
+        waktuUbah += info.st_mtim.tv_nsec; // Resolusi nanodetik jika tersedia
+#endif
     }
     
     // Helper: Cek apakah file exists
@@ -65,55 +403,301 @@ public:
         return jumlah;
     }
     
-    // Baca file dan kembalikan semua baris (max 1000 baris)
-    static int bacaSemuaBaris(const string& namaFile, string baris[], int maksimal = 1000) {
-        ifstream file(namaFile);
-        if (!file.is_open()) {
-            cout << "[ERROR] Tidak dapat membuka file: " << namaFile << endl;
+    // Helper: Trim potongan baris [data, data + panjang) lalu kirim ke func
+    // Return false jika baris kosong setelah di-trim
+    template<typename Function>
+    static bool prosesBaris(const char* data, size_t panjang, string& baris, Function& func) {
+        PotonganString isi = trimPotongan(PotonganString(data, panjang));
+        if (isi.kosong()) return false;
+        
+        baris.assign(isi.data, isi.panjang);
+        func(baris);
+        return true;
+    }
+    
+    // Helper: Proses semua baris di memori [awal, akhir), return jumlah baris
+    template<typename Function>
+    static int prosesRentang(const char* awal, const char* akhir, Function& func) {
+        string baris; // Dipakai ulang untuk setiap baris
+        int jumlah = 0;
+        
+        while (awal < akhir) {
+            const char* newline = static_cast<const char*>(memchr(awal, '\n', akhir - awal));
+            if (newline == nullptr) newline = akhir;
+            
+            if (prosesBaris(awal, newline - awal, baris, func)) jumlah++;
+            awal = newline + 1;
+        }
+        
+        return jumlah;
+    }
+
+#ifdef PENGELOLA_FILE_MMAP
+    // Helper: Map seluruh file ke memori (read-only), nullptr jika file tidak
+    // ada/kosong/gagal map. Lepas dengan munmap(peta, ukuran)
+    static const char* petakanFile(const string& namaFile, size_t& ukuran) {
+        int fd = open(namaFile.c_str(), O_RDONLY);
+        if (fd < 0) return nullptr;
+        
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            close(fd);
+            return nullptr;
+        }
+        
+        ukuran = static_cast<size_t>(info.st_size);
+        void* peta = mmap(nullptr, ukuran, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // Mapping tetap valid setelah fd ditutup
+        
+        if (peta == MAP_FAILED) return nullptr;
+        
+        // File dibaca sekali dari awal ke akhir: minta kernel read-ahead agresif
+        madvise(peta, ukuran, MADV_SEQUENTIAL);
+        return static_cast<const char*>(peta);
+    }
+    
+    // Helper: Baca file lewat mmap, baris di-scan langsung dari halaman
+    // memori file tanpa fread. Return false jika mmap tidak bisa dipakai
+    // (file tidak ada/kosong/gagal map) agar pemanggil pakai fallback
+    template<typename Function>
+    static bool bacaPerBarisMmap(const string& namaFile, Function& func, int& jumlah) {
+        size_t ukuran;
+        const char* peta = petakanFile(namaFile, ukuran);
+        if (peta == nullptr) return false;
+        
+        jumlah = prosesRentang(peta, peta + ukuran, func);
+        
+        munmap(const_cast<char*>(peta), ukuran);
+        return true;
+    }
+#endif
+    
+    // Helper: Baca seluruh isi file ke buffer baru (delete[] oleh pemanggil)
+    // nullptr jika file tidak bisa dibuka atau kosong
+    static char* bacaSeluruhFile(const string& namaFile, size_t& ukuran) {
+        FILE* file = fopen(namaFile.c_str(), "rb");
+        if (file == nullptr) {
+            cetakBaris("[ERROR] Tidak dapat membuka file: " + namaFile);
+            return nullptr;
+        }
+        
+        long long ukuranFile, waktuUbah;
+        infoFile(namaFile, ukuranFile, waktuUbah);
+        if (ukuranFile <= 0) {
+            fclose(file);
+            return nullptr;
+        }
+        
+        char* buffer = new char[ukuranFile];
+        ukuran = fread(buffer, 1, ukuranFile, file);
+        fclose(file);
+        
+        return buffer;
+    }
+    
+    // Baca file dengan beberapa thread sekaligus: isi file dibagi menjadi
+    // jumlahBagian potongan (batas selalu di akhir baris, minimal 1 MB per
+    // potongan) dan setiap potongan di-scan oleh thread sendiri
+    // func(int bagian, const string& baris): bagian 0..jumlahBagian-1 sesuai
+    // urutan di file. func dipanggil bersamaan dari beberapa thread, jadi
+    // hanya boleh menulis ke data milik bagiannya sendiri
+    // Exception dari func dilempar ulang di thread pemanggil setelah semua
+    // thread selesai (yang pertama menurut urutan bagian)
+    // Return jumlah baris yang diproses
+    template<typename Function>
+    static int bacaPerBarisParalel(const string& namaFile, int jumlahBagian, Function func) {
+        const char* data = nullptr;
+        char* buffer = nullptr;
+        size_t ukuran = 0;
+
+#ifdef PENGELOLA_FILE_MMAP
+        data = petakanFile(namaFile, ukuran);
+#endif
+        if (data == nullptr) {
+            buffer = bacaSeluruhFile(namaFile, ukuran);
+            if (buffer == nullptr) return 0;
+            data = buffer;
+        }
+        
+        // Potongan terlalu kecil tidak sebanding dengan biaya membuat thread
+        size_t maksBagian = ukuran / UKURAN_MIN_BAGIAN_PARALEL + 1;
+        if (jumlahBagian < 1) jumlahBagian = 1;
+        if ((size_t)jumlahBagian > maksBagian) jumlahBagian = (int)maksBagian;
+        
+        // Batas potongan: maju ke awal baris berikutnya
+        const char* akhir = data + ukuran;
+        const char** batas = new const char*[jumlahBagian + 1];
+        batas[0] = data;
+        batas[jumlahBagian] = akhir;
+        
+        for (int i = 1; i < jumlahBagian; i++) {
+            const char* posisi = data + ukuran / jumlahBagian * i;
+            if (posisi < batas[i - 1]) posisi = batas[i - 1];
+            
+            const char* newline = static_cast<const char*>(memchr(posisi, '\n', akhir - posisi));
+            batas[i] = (newline != nullptr) ? newline + 1 : akhir;
+        }
+        
+        // Exception ditangkap per bagian: yang lolos dari thread memanggil terminate
+        int* jumlahBaris = new int[jumlahBagian];
+        exception_ptr* galat = new exception_ptr[jumlahBagian];
+        auto proses = [&](int bagian) {
+            try {
+                auto funcBagian = [&](const string& baris) { func(bagian, baris); };
+                jumlahBaris[bagian] = prosesRentang(batas[bagian], batas[bagian + 1], funcBagian);
+            } catch (...) {
+                jumlahBaris[bagian] = 0;
+                galat[bagian] = current_exception();
+            }
+        };
+        
+        // Bagian 0 dikerjakan di thread pemanggil
+        // Thread gagal dibuat: bagian itu dikerjakan di thread pemanggil juga
+        thread* pekerja = new thread[jumlahBagian - 1];
+        for (int i = 1; i < jumlahBagian; i++) {
+            try {
+                pekerja[i - 1] = thread(proses, i);
+            } catch (const system_error&) {
+                proses(i);
+            }
+        }
+        proses(0);
+        
+        int total = jumlahBaris[0];
+        for (int i = 1; i < jumlahBagian; i++) {
+            if (pekerja[i - 1].joinable()) pekerja[i - 1].join();
+            total += jumlahBaris[i];
+        }
+        
+        // Exception pertama (urutan bagian) dilempar setelah semua buffer dilepas
+        exception_ptr galatPertama;
+        for (int i = 0; i < jumlahBagian && !galatPertama; i++) {
+            galatPertama = galat[i];
+        }
+        
+        delete[] pekerja;
+        delete[] galat;
+        delete[] jumlahBaris;
+        delete[] batas;
+
+#ifdef PENGELOLA_FILE_MMAP
+        if (buffer == nullptr) munmap(const_cast<char*>(data), ukuran);
+#endif
+        delete[] buffer;
+        
+        if (galatPertama) rethrow_exception(galatPertama);
+        return total;
+    }
+    
+    // Baca file baris per baris (streaming, tanpa batas jumlah record)
+    // func(const string& baris) dipanggil untuk setiap baris yang sudah di-trim
+    // dan tidak kosong. Return jumlah baris yang diproses
+    // POSIX: lewat mmap + madvise(SEQUENTIAL), selain itu fread + buffer 1 MB
+    template<typename Function>
+    static int bacaPerBaris(const string& namaFile, Function func) {
+#ifdef PENGELOLA_FILE_MMAP
+        int jumlahMmap;
+        if (bacaPerBarisMmap(namaFile, func, jumlahMmap)) {
+            return jumlahMmap;
+        }
+#endif
+        
+        FILE* file = fopen(namaFile.c_str(), "rb");
+        if (file == nullptr) {
+            cetakBaris("[ERROR] Tidak dapat membuka file: " + namaFile);
             return 0;
         }
         
+        char* buffer = new char[UKURAN_BUFFER_FILE];
+        string sisa;   // Potongan baris yang terpotong di akhir buffer
+        string baris;  // Dipakai ulang untuk setiap baris
         int jumlah = 0;
-        string line;
-        
-        while (getline(file, line) && jumlah < maksimal) {
-            line = trim(line);
-            if (!line.empty()) {
-                baris[jumlah++] = line;
+        size_t terbaca;
+        
+        while ((terbaca = fread(buffer, 1, UKURAN_BUFFER_FILE, file)) > 0) {
+            const char* awal = buffer;
+            const char* akhir = buffer + terbaca;
+            
+            while (awal < akhir) {
+                const char* newline = static_cast<const char*>(memchr(awal, '\n', akhir - awal));
+                
+                if (newline == nullptr) {
+                    sisa.append(awal, akhir - awal);
+                    break;
+                }
+                
+                if (!sisa.empty()) {
+                    sisa.append(awal, newline - awal);
+                    if (prosesBaris(sisa.data(), sisa.length(), baris, func)) jumlah++;
+                    sisa.clear();
+                } else if (prosesBaris(awal, newline - awal, baris, func)) {
+                    jumlah++;
+                }
+                
+                awal = newline + 1;
             }
         }
         
-        file.close();
+        // Baris terakhir tanpa newline
+        if (!sisa.empty() && prosesBaris(sisa.data(), sisa.length(), baris, func)) {
+            jumlah++;
+        }
+        
+        delete[] buffer;
+        fclose(file);
         return jumlah;
     }
     
-    // Tulis array string ke file (overwrite)
-    static bool tulisSemuaBaris(const string& namaFile, const string baris[], int jumlah) {
-        ofstream file(namaFile, ios::trunc);
-        if (!file.is_open()) {
-            cout << "[ERROR] Tidak dapat menulis ke file: " << namaFile << endl;
+    // Tulis file (overwrite) secara streaming, tanpa batas jumlah record
+    // isi(PenulisFile& penulis) menulis baris-barisnya lewat penulis.tulisBaris()
+    // File tujuan diganti secara atomik setelah semua baris tertulis
+    template<typename Function>
+    static bool tulisPerBaris(const string& namaFile, Function isi,
+                              const OpsiTulis& opsi = OpsiTulis()) {
+        PenulisFile penulis(namaFile, false, opsi);
+        if (!penulis.terbuka()) {
+            cetakBaris("[ERROR] Tidak dapat menulis ke file: " + namaFile);
             return false;
         }
         
-        for (int i = 0; i < jumlah; i++) {
-            file << baris[i] << endl;
-        }
-        
-        file.close();
-        return true;
+        isi(penulis);
+        return penulis.tutup();
+    }
+    
+    // Tulis array string ke file (overwrite, atomik)
+    static bool tulisSemuaBaris(const string& namaFile, const string baris[], int jumlah,
+                                const OpsiTulis& opsi = OpsiTulis()) {
+        return tulisPerBaris(namaFile, [&](PenulisFile& penulis) {
+            for (int i = 0; i < jumlah; i++) {
+                penulis.tulisBaris(baris[i]);
+            }
+        }, opsi);
     }
     
     // Append satu baris ke file
     static bool tambahBaris(const string& namaFile, const string& baris) {
-        ofstream file(namaFile, ios::app);
-        if (!file.is_open()) {
-            cout << "[ERROR] Tidak dapat menambah ke file: " << namaFile << endl;
+        PenulisFile penulis(namaFile, true);
+        if (!penulis.terbuka()) {
+            cetakBaris("[ERROR] Tidak dapat menambah ke file: " + namaFile);
             return false;
         }
         
-        file << baris << endl;
-        file.close();
-        return true;
+        penulis.tulisBaris(baris);
+        return penulis.tutup();
+    }
+    
+    // Salin semua baris tidak kosong dari satu file ke file lain (streaming)
+    static bool salinBaris(const string& sumber, const string& tujuan) {
+        return tulisPerBaris(tujuan, [&](PenulisFile& penulis) {
+            bacaPerBaris(sumber, [&](const string& baris) {
+                penulis.tulisBaris(baris);
+            });
+        });
+    }
+    
+    // Paksa isi file tersimpan ke disk (lihat PenulisFile::sinkronkan)
+    static bool sinkronkanFile(FILE* file) {
+        return PenulisFile::sinkronkan(file);
     }
     
     // Hapus file
@@ -132,12 +716,12 @@ public:
         
         ofstream file(namaFile);
         if (!file.is_open()) {
-            cout << "[ERROR] Tidak dapat membuat file: " << namaFile << endl;
+            cetakBaris("[ERROR] Tidak dapat membuat file: " + namaFile);
             return false;
         }
         
         file.close();
-        cout << "[INFO] File dibuat: " << namaFile << endl;
+        cetakBaris("[INFO] File dibuat: " + namaFile);
         return true;
     }
     
@@ -284,24 +868,39 @@ public:
         return "Rp " + to_string(rupiah);
     }
     
+    static string formatRupiah(const Rupiah& nominal) {
+        string str = nominal.toString();
+        size_t titik = str.find('.');
+        if (titik != string::npos) str[titik] = ','; // Desimal sen pakai koma
+        
+        return "Rp " + str;
+    }
+    
     // Format rupiah dengan separator ribuan
     static string formatRupiahLengkap(double nominal) {
-        long long rupiah = static_cast<long long>(nominal);
-        string str = to_string(rupiah);
-        string result = "";
-        int counter = 0;
+        return formatRupiahLengkap(Rupiah::dariRupiah(static_cast<long long>(nominal)));
+    }
+    
+    // Contoh: Rp 1.419.752,05 (sen hanya ditampilkan jika tidak nol)
+    static string formatRupiahLengkap(const Rupiah& nominal) {
+        long long rupiah = nominal.getRupiah();
+        string str = to_string(rupiah < 0 ? -rupiah : rupiah);
+        string result = (nominal.getSen() < 0) ? "Rp -" : "Rp ";
+        
+        // Separator ribuan setiap 3 digit dari belakang
+        for (size_t i = 0; i < str.length(); i++) {
+            if (i > 0 && (str.length() - i) % 3 == 0) result += '.';
+            result += str[i];
+        }
         
-        // Tambahkan separator dari belakang
-        for (int i = str.length() - 1; i >= 0; i--) {
-            if (counter == 3) {
-                result = "." + result;
-                counter = 0;
-            }
-            result = str[i] + result;
-            counter++;
+        int sen = nominal.getSisaSen();
+        if (sen != 0) {
+            result += ',';
+            result += (char)('0' + sen / 10);
+            result += (char)('0' + sen % 10);
         }
         
-        return "Rp " + result;
+        return result;
     }
 };
 
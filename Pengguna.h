@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "PengelolaFile.h"
 using namespace std;
 
@@ -32,29 +33,32 @@ protected:
 
 public:
     // Constructor
-    Pengguna(const string& _id, const string& _nama, const string& _email,
-             const string& _nomorTelepon, const string& _password, 
+    // Argumen string diambil by value lalu di-move (sink): pemanggil yang
+    // memberi temporary/std::move tidak menyalin string sama sekali
+    Pengguna(string _id, string _nama, string _email,
+             string _nomorTelepon, string _password, 
              RolePengguna _role)
-        : id(_id), nama(_nama), email(_email), nomorTelepon(_nomorTelepon),
-          password(_password), role(_role), aktif(true) {}
+        : id(std::move(_id)), nama(std::move(_nama)), email(std::move(_email)),
+          nomorTelepon(std::move(_nomorTelepon)), password(std::move(_password)),
+          role(_role), aktif(true) {}
     
     // Virtual destructor untuk polymorphism
     virtual ~Pengguna() {}
     
     // Getter
-    string getId() const { return id; }
-    string getNama() const { return nama; }
-    string getEmail() const { return email; }
-    string getNomorTelepon() const { return nomorTelepon; }
-    string getPassword() const { return password; }
+    const string& getId() const { return id; }
+    const string& getNama() const { return nama; }
+    const string& getEmail() const { return email; }
+    const string& getNomorTelepon() const { return nomorTelepon; }
+    const string& getPassword() const { return password; }
     RolePengguna getRole() const { return role; }
     bool isAktif() const { return aktif; }
     
     // Setter
-    void setNama(const string& _nama) { nama = _nama; }
-    void setEmail(const string& _email) { email = _email; }
-    void setNomorTelepon(const string& _nomor) { nomorTelepon = _nomor; }
-    void setPassword(const string& _password) { password = _password; }
+    void setNama(string _nama) { nama = std::move(_nama); }
+    void setEmail(string _email) { email = std::move(_email); }
+    void setNomorTelepon(string _nomor) { nomorTelepon = std::move(_nomor); }
+    void setPassword(string _password) { password = std::move(_password); }
     void setAktif(bool _aktif) { aktif = _aktif; }
     
     // Helper: Convert role ke string
@@ -111,24 +115,25 @@ class Pelanggan : public Pengguna {
 private:
     string alamat;
     int totalTransaksi;
-    double totalBelanja;
+    Rupiah totalBelanja;
 
 public:
     // Constructor
-    Pelanggan(const string& _id, const string& _nama, const string& _email,
-              const string& _nomorTelepon, const string& _password,
-              const string& _alamat = "")
-        : Pengguna(_id, _nama, _email, _nomorTelepon, _password, RolePengguna::PELANGGAN),
-          alamat(_alamat), totalTransaksi(0), totalBelanja(0.0) {}
+    Pelanggan(string _id, string _nama, string _email,
+              string _nomorTelepon, string _password,
+              string _alamat = "")
+        : Pengguna(std::move(_id), std::move(_nama), std::move(_email),
+                   std::move(_nomorTelepon), std::move(_password), RolePengguna::PELANGGAN),
+          alamat(std::move(_alamat)), totalTransaksi(0), totalBelanja() {}
     
     // Getter khusus pelanggan
-    string getAlamat() const { return alamat; }
+    const string& getAlamat() const { return alamat; }
     int getTotalTransaksi() const { return totalTransaksi; }
-    double getTotalBelanja() const { return totalBelanja; }
+    Rupiah getTotalBelanja() const { return totalBelanja; }
     
     // Setter
-    void setAlamat(const string& _alamat) { alamat = _alamat; }
-    void tambahTransaksi(double nominal) {
+    void setAlamat(string _alamat) { alamat = std::move(_alamat); }
+    void tambahTransaksi(const Rupiah& nominal) {
         totalTransaksi++;
         totalBelanja += nominal;
     }
@@ -153,7 +158,7 @@ public:
         fields[6] = (aktif ? "1" : "0");
         fields[7] = alamat;
         fields[8] = to_string(totalTransaksi);
-        fields[9] = to_string(static_cast<long long>(totalBelanja));
+        fields[9] = totalBelanja.toString();
         
         return PengelolaFile::gabungField(fields, 10);
     }
@@ -171,22 +176,24 @@ private:
 
 public:
     // Constructor
-    Pegawai(const string& _id, const string& _nama, const string& _email,
-            const string& _nomorTelepon, const string& _password,
-            const string& _posisi, const string& _shift = "Pagi",
+    Pegawai(string _id, string _nama, string _email,
+            string _nomorTelepon, string _password,
+            string _posisi, string _shift = "Pagi",
             double _gaji = 5000000.0)
-        : Pengguna(_id, _nama, _email, _nomorTelepon, _password, RolePengguna::PEGAWAI),
-          posisi(_posisi), shift(_shift), gaji(_gaji), jumlahBookingDitangani(0) {}
+        : Pengguna(std::move(_id), std::move(_nama), std::move(_email),
+                   std::move(_nomorTelepon), std::move(_password), RolePengguna::PEGAWAI),
+          posisi(std::move(_posisi)), shift(std::move(_shift)), gaji(_gaji),
+          jumlahBookingDitangani(0) {}
     
     // Getter
-    string getPosisi() const { return posisi; }
-    string getShift() const { return shift; }
+    const string& getPosisi() const { return posisi; }
+    const string& getShift() const { return shift; }
     double getGaji() const { return gaji; }
     int getJumlahBookingDitangani() const { return jumlahBookingDitangani; }
     
     // Setter
-    void setPosisi(const string& _posisi) { posisi = _posisi; }
-    void setShift(const string& _shift) { shift = _shift; }
+    void setPosisi(string _posisi) { posisi = std::move(_posisi); }
+    void setShift(string _shift) { shift = std::move(_shift); }
     void setGaji(double _gaji) { gaji = _gaji; }
     void tambahBookingDitangani() { jumlahBookingDitangani++; }
     
@@ -224,9 +231,10 @@ public:
 class Pemilik : public Pengguna {
 public:
     // Constructor
-    Pemilik(const string& _id, const string& _nama, const string& _email,
-            const string& _nomorTelepon, const string& _password)
-        : Pengguna(_id, _nama, _email, _nomorTelepon, _password, RolePengguna::PEMILIK) {}
+    Pemilik(string _id, string _nama, string _email,
+            string _nomorTelepon, string _password)
+        : Pengguna(std::move(_id), std::move(_nama), std::move(_email),
+                   std::move(_nomorTelepon), std::move(_password), RolePengguna::PEMILIK) {}
     
     // Pemilik punya akses penuh, tidak perlu field tambahan
     
@@ -0,0 +1,58 @@
+#ifndef POTONGAN_STRING_H
+#define POTONGAN_STRING_H
+
+#include <iostream>
+#include <string>
+#include <cstring>
+using namespace std;
+
+// ============================================================================
+// POTONGAN STRING - VIEW TANPA ALOKASI
+// ============================================================================
+// Menunjuk ke sebagian isi string lain (pointer + panjang), tidak menyalin
+// Digunakan oleh PengelolaFile::splitPotongan untuk field hasil parsing
+// PENTING: Hanya valid selama string sumbernya masih hidup & tidak diubah
+// ============================================================================
+
+struct PotonganString {
+    const char* data;
+    size_t panjang;
+    
+    // Constructor
+    PotonganString() : data(""), panjang(0) {}
+    PotonganString(const char* _data, size_t _panjang) : data(_data), panjang(_panjang) {}
+    PotonganString(const string& str) : data(str.data()), panjang(str.length()) {}
+    
+    bool kosong() const { return panjang == 0; }
+    
+    char operator[](size_t index) const { return data[index]; }
+    
+    // Salin menjadi string (hanya untuk field yang memang perlu disimpan)
+    string toString() const {
+        return string(data, panjang);
+    }
+    
+    // Potongan mulai dari index awal sampai akhir
+    PotonganString dari(size_t awal) const {
+        if (awal >= panjang) return PotonganString(data + panjang, 0);
+        return PotonganString(data + awal, panjang - awal);
+    }
+    
+    // Cek awalan
+    bool mulaiDengan(const char* awalan) const {
+        size_t n = strlen(awalan);
+        return n <= panjang && memcmp(data, awalan, n) == 0;
+    }
+    
+    // Bandingkan dengan literal, contoh: if (fields[3] == "CONFIRMED")
+    bool operator==(const char* literal) const {
+        size_t n = strlen(literal);
+        return n == panjang && memcmp(data, literal, n) == 0;
+    }
+    
+    bool operator!=(const char* literal) const {
+        return !(*this == literal);
+    }
+};
+
+#endif
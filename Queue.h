@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
+#include "AlokatorNode.h"
 using namespace std;
 
 // ============================================================================
@@ -17,16 +19,18 @@ struct QueueNode {
     T data;
     QueueNode<T>* next;
     
-    QueueNode(const T& nilai) : data(nilai), next(nullptr) {}
+    template<typename... Args>
+    QueueNode(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alokator = AlokatorPool<QueueNode<T> > >
 class Queue {
 private:
     QueueNode<T>* front; // Depan antrian (untuk dequeue)
     QueueNode<T>* rear;  // Belakang antrian (untuk enqueue)
     int jumlahItem;
     int maksimalKapasitas;
+    Alokator alokator;
 
 public:
     // Constructor
@@ -58,13 +62,23 @@ public:
     
     // Enqueue - Tambah data ke belakang antrian
     bool enqueue(const T& data) {
+        return enqueueBaru(data);
+    }
+    
+    bool enqueue(T&& data) {
+        return enqueueBaru(std::move(data));
+    }
+    
+    // Enqueue dengan data dibangun langsung di node (emplace)
+    template<typename... Args>
+    bool enqueueBaru(Args&&... args) {
         if (penuh()) {
             cout << "[QUEUE PENUH] Tidak dapat menambah ke antrian. Max: " 
                  << maksimalKapasitas << endl;
             return false;
         }
         
-        QueueNode<T>* nodeBaru = new QueueNode<T>(data);
+        QueueNode<T>* nodeBaru = alokator.alokasi(std::forward<Args>(args)...);
         
         if (kosong()) {
             // Queue kosong, front dan rear sama
@@ -95,7 +109,7 @@ public:
             rear = nullptr;
         }
         
-        delete temp;
+        alokator.dealokasi(temp);
         jumlahItem--;
         
         return true;
@@ -114,7 +128,7 @@ public:
             rear = nullptr;
         }
         
-        delete temp;
+        alokator.dealokasi(temp);
         jumlahItem--;
         
         return true;
@@ -231,7 +245,7 @@ public:
                     previous->next = current->next;
                 }
                 
-                delete current;
+                alokator.dealokasi(current);
                 jumlahItem--;
                 return true;
             }
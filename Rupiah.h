@@ -0,0 +1,112 @@
+#ifndef RUPIAH_H
+#define RUPIAH_H
+
+#include <string>
+#include <cstdint>
+#include <cmath>
+using namespace std;
+
+// ============================================================================
+// RUPIAH - NOMINAL UANG FIXED-POINT (INT64 DALAM SEN)
+// ============================================================================
+// Harga, subtotal, pajak & total disimpan sebagai jumlah sen (1/100 Rupiah)
+// dalam int64, bukan double:
+// - Penjumlahan & perkalian kuantitas selalu eksak (tidak ada drift)
+// - Persentase (PPN 10%, service 5%) dibulatkan half-up ke sen terdekat,
+//   untuk harga Rupiah bulat hasilnya selalu eksak tanpa pembulatan
+// - Penjumlahan array int64 bisa divektorisasi compiler
+// Rentang: +/- 92 triliun Rupiah
+// Format file: "1955000" atau "1419752.05" (titik desimal, maksimal 2 digit)
+// ============================================================================
+
+class Rupiah {
+private:
+    int64_t sen;
+    
+    // Helper: Bagi dengan pembulatan half-up (menjauhi nol)
+    static int64_t bagiBulat(int64_t pembilang, int64_t penyebut) {
+        int64_t setengah = penyebut / 2;
+        return (pembilang >= 0) ? (pembilang + setengah) / penyebut
+                                : (pembilang - setengah) / penyebut;
+    }
+
+public:
+    static const int64_t SEN_PER_RUPIAH = 100;
+    
+    // Constructor - nol
+    Rupiah() : sen(0) {}
+    
+    // Factory
+    static Rupiah dariSen(int64_t _sen) {
+        Rupiah hasil;
+        hasil.sen = _sen;
+        return hasil;
+    }
+    
+    static Rupiah dariRupiah(long long rupiah) {
+        return dariSen(rupiah * SEN_PER_RUPIAH);
+    }
+    
+    // Dari input double (menu), dibulatkan ke sen terdekat
+    static Rupiah dariDouble(double nominal) {
+        return dariSen(llround(nominal * SEN_PER_RUPIAH));
+    }
+    
+    // Getter
+    int64_t getSen() const { return sen; }
+    long long getRupiah() const { return sen / SEN_PER_RUPIAH; }   // Sen dibuang
+    int getSisaSen() const { return (int)((sen < 0 ? -sen : sen) % SEN_PER_RUPIAH); }
+    bool nol() const { return sen == 0; }
+    
+    // Hanya untuk rasio/persentase tampilan, bukan untuk hitungan uang
+    double toDouble() const { return (double)sen / SEN_PER_RUPIAH; }
+    
+    // persen% dari nominal ini, dibulatkan ke sen terdekat
+    Rupiah persen(int persen) const {
+        return dariSen(bagiBulat(sen * persen, 100));
+    }
+    
+    // Nilai dasar sebelum ditambah persenTambahan%
+    // Contoh: total 1.150.000 dengan PPN + service 15% -> dasar 1.000.000
+    Rupiah dasarSebelum(int persenTambahan) const {
+        return dariSen(bagiBulat(sen * 100, 100 + persenTambahan));
+    }
+    
+    // Rata-rata: dibagi n, dibulatkan ke sen terdekat
+    Rupiah bagi(long long n) const {
+        return (n == 0) ? Rupiah() : dariSen(bagiBulat(sen, n));
+    }
+    
+    // Operator aritmatika
+    Rupiah operator+(const Rupiah& lain) const { return dariSen(sen + lain.sen); }
+    Rupiah operator-(const Rupiah& lain) const { return dariSen(sen - lain.sen); }
+    Rupiah operator-() const { return dariSen(-sen); }
+    Rupiah operator*(long long kuantitas) const { return dariSen(sen * kuantitas); }
+    
+    Rupiah& operator+=(const Rupiah& lain) { sen += lain.sen; return *this; }
+    Rupiah& operator-=(const Rupiah& lain) { sen -= lain.sen; return *this; }
+    
+    // Operator perbandingan
+    bool operator==(const Rupiah& lain) const { return sen == lain.sen; }
+    bool operator!=(const Rupiah& lain) const { return sen != lain.sen; }
+    bool operator<(const Rupiah& lain) const { return sen < lain.sen; }
+    bool operator<=(const Rupiah& lain) const { return sen <= lain.sen; }
+    bool operator>(const Rupiah& lain) const { return sen > lain.sen; }
+    bool operator>=(const Rupiah& lain) const { return sen >= lain.sen; }
+    
+    // Format untuk file: Rupiah bulat tanpa desimal, selain itu ".xx"
+    string toString() const {
+        string hasil = (sen < 0 && getRupiah() == 0) ? "-0" : to_string(getRupiah());
+        
+        int sisa = getSisaSen();
+        if (sisa != 0) {
+            hasil += '.';
+            hasil += (char)('0' + sisa / 10);
+            hasil += (char)('0' + sisa % 10);
+        }
+        
+        return hasil;
+    }
+};
+
+#endif
@@ -3,9 +3,15 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "CircularLinkedList.h"
+#include "TabelHash.h"
 #include "Stack.h"
 #include "PengelolaFile.h"
+#include "LogPerubahan.h"
+#include "SnapshotBiner.h"
+#include "KalenderKamar.h"
+#include "KubusPendapatan.h"
 #include "Transaksi.h"
 #include "Pengguna.h"
 using namespace std;
@@ -14,19 +20,311 @@ using namespace std;
 // SISTEM PEMBAYARAN - PAYMENT PROCESSING
 // ============================================================================
 // Mengelola: Proses pembayaran, Generate struk, History transaksi
+// Index hash by ID transaksi & by ID pelanggan (riwayat per customer)
+// Penyimpanan: transaksi.txt (snapshot) + transaksi.log (append-only)
+// - Transaksi baru / ubah status cukup menambah 1 record di log
+// - Saat load, log diputar ulang di atas snapshot
+// - Kompaksi (tulis ulang snapshot, kosongkan log) saat log mencapai
+//   BATAS_KOMPAKSI record dan saat program keluar
+// Item booking disimpan terpisah di transaksi_item.txt (append-only,
+// ITEM|IDTransaksi|<ItemBooking::toFileFormat>) dan baru dimuat saat
+// dibutuhkan laporan (muatItemTransaksi), bukan saat startup
+// Kalender kamar (milik ManajemenKamar) diisi dari item KAMAR transaksi yang
+// tidak dibatalkan saat pertama dibutuhkan (siapkanKalender), lalu dijaga
+// tetap sinkron saat pembayaran & pembatalan
+// Statistik keuangan (jumlah per status & pendapatan) dijaga incremental di
+// tambahTransaksi & ubahStatus; compile dengan -DPERIKSA_STATISTIK untuk
+// mencocokkannya dengan hitung ulang dari nol setiap kali ditampilkan
+// Rekap pendapatan harian (KubusPendapatan) ikut dijaga di jalur yang sama
+// untuk laporan per rentang tanggal, dibangun ulang sekali setelah item dimuat
 // ============================================================================
 
+// Agregat semua transaksi, dijaga incremental oleh SistemPembayaran
+struct AgregatTransaksi {
+    int perStatus[4];       // index = StatusTransaksi
+    Rupiah pendapatan;      // Total akhir transaksi CONFIRMED + COMPLETED
+    
+    AgregatTransaksi() : perStatus(), pendapatan() {}
+    
+    bool operator==(const AgregatTransaksi& lain) const {
+        for (int i = 0; i < 4; i++) {
+            if (perStatus[i] != lain.perStatus[i]) return false;
+        }
+        return pendapatan == lain.pendapatan;
+    }
+};
+
 class SistemPembayaran {
 private:
     CircularLinkedList<Transaksi*> daftarTransaksi;
+    TabelHash<Transaksi*> indexTransaksi;                      // ID transaksi -> transaksi
+    TabelHash<CircularLinkedList<Transaksi*>*> indexPelanggan; // ID pelanggan -> riwayat
     Stack<string> historyPembayaran; // Stack untuk history (struk ID)
     string namaFileTransaksi;
+    LogPerubahan logTransaksi;
+    LogPerubahan logItem;
+    bool itemDimuat;    // transaksi_item.txt sudah diputar ulang
+    KalenderKamar* kalender;
+    bool kalenderSiap;  // Kalender sudah diisi dari semua transaksi
     int counterTransaksi;
+    AgregatTransaksi agregat;
+    KubusPendapatan kubus;      // Rekap harian untuk LaporanKeuangan
+    
+    static const int BATAS_KOMPAKSI = 5000;
+    
+    // Helper: Format satu transaksi menjadi baris file
+    // Format: ID|IDPelanggan|Nama|Status|Total|Tanggal|JumlahItem|Metode|CheckIn|CheckOut
+    static string formatBarisTransaksi(Transaksi* t) {
+        string fields[10];
+        fields[0] = t->getIdTransaksi();
+        fields[1] = t->getIdPelanggan();
+        fields[2] = t->getNamaPelanggan();
+        fields[3] = t->getStatusString();
+        fields[4] = t->getTotalAkhir().toString();
+        fields[5] = t->getTanggalTransaksi();
+        fields[6] = to_string(t->getJumlahItem());
+        fields[7] = t->getMetodeBayarString();
+        fields[8] = t->getTanggalCheckIn();
+        fields[9] = t->getTanggalCheckOut();
+        
+        return PengelolaFile::gabungField(fields, 10);
+    }
+    
+    // Helper: Parse status dari teks (tidak dikenal: PENDING)
+    static StatusTransaksi parseStatus(const PotonganString& statusStr) {
+        if (statusStr == "CONFIRMED") return StatusTransaksi::CONFIRMED;
+        if (statusStr == "COMPLETED") return StatusTransaksi::COMPLETED;
+        if (statusStr == "CANCELLED") return StatusTransaksi::CANCELLED;
+        return StatusTransaksi::PENDING;
+    }
+    
+    // Helper: Parse metode pembayaran dari teks (tidak dikenal: TUNAI)
+    static MetodePembayaran parseMetode(const PotonganString& metodeStr) {
+        if (metodeStr == "TRANSFER_BANK") return MetodePembayaran::TRANSFER_BANK;
+        if (metodeStr == "KARTU_KREDIT") return MetodePembayaran::KARTU_KREDIT;
+        // Penulis menyimpan "E-WALLET" (Transaksi::metodeKeString), "EWALLET"
+        // tetap diterima untuk data lama
+        if (metodeStr == "E-WALLET" || metodeStr == "EWALLET") return MetodePembayaran::EWALLET;
+        return MetodePembayaran::TUNAI;
+    }
+    
+    // Helper: Buat transaksi tersimpan (dari file teks / snapshot biner)
+    // String by value (sink): hasil parse teks berupa temporary sehingga di-move
+    static Transaksi* buatTransaksi(string id, string idPelanggan,
+                                    string nama, string tanggal,
+                                    StatusTransaksi status, MetodePembayaran metode,
+                                    string checkIn, string checkOut,
+                                    int jumlahItem, const Rupiah& total) {
+        // Buat transaksi baru dengan constructor yang benar (4 params)
+        Transaksi* t = new Transaksi(std::move(id), std::move(idPelanggan),
+                                     std::move(nama), std::move(tanggal));
+        t->setStatus(status);
+        t->setTanggalCheckIn(std::move(checkIn));
+        t->setTanggalCheckOut(std::move(checkOut));
+        t->setJumlahItemDariFile(jumlahItem);
+        t->setMetodeBayar(metode);
+        
+        // ? SET TOTAL DARI FILE! (CRITICAL FIX)
+        // Total dari file sudah include PPN + Service
+        // Reverse calculate: total = subtotal + PPN 10% + service 5%
+        Rupiah subtotal = total.dasarSebelum(Transaksi::PERSEN_PAJAK + Transaksi::PERSEN_LAYANAN);
+        Rupiah ppn = subtotal.persen(Transaksi::PERSEN_PAJAK);
+        Rupiah service = subtotal.persen(Transaksi::PERSEN_LAYANAN);
+        t->setTotalDariFile(subtotal, ppn, service, total);
+        
+        return t;
+    }
+    
+    // Helper: Buat transaksi dari field baris file, nullptr jika tidak valid
+    // Field sudah di-trim oleh splitPotongan, angka di-parse langsung dari potongan
+    static Transaksi* parseTransaksi(const PotonganString fields[], int fieldCount) {
+        if (fieldCount < 9) return nullptr; // Skip baris yang tidak valid
+        
+        Rupiah total;
+        int jumlahItem;
+        if (!PengelolaFile::parseRupiah(fields[4], total) ||
+            !PengelolaFile::parseInt(fields[6], jumlahItem)) {
+            return nullptr; // Skip baris dengan angka tidak valid
+        }
+        
+        return buatTransaksi(fields[0].toString(), fields[1].toString(),
+                             fields[2].toString(), fields[5].toString(),
+                             parseStatus(fields[3]), parseMetode(fields[7]),
+                             fields[8].toString(), fieldCount > 9 ? fields[9].toString() : "",
+                             jumlahItem, total);
+    }
+    
+    // Helper: Parse item booking dari field baris file lalu pasang ke transaksi
+    // Format: Jenis|IDItem|Nama|Harga|Kuantitas|Subtotal|Mulai|Selesai|Keterangan
+    static bool pasangItem(Transaksi* t, const PotonganString fields[], int fieldCount) {
+        if (fieldCount < 8) return false;
+        
+        Rupiah harga;
+        int kuantitas;
+        if (!PengelolaFile::parseRupiah(fields[3], harga) ||
+            !PengelolaFile::parseInt(fields[4], kuantitas)) {
+            return false;
+        }
+        
+        JenisItem jenis = (fields[0] == "KAMAR") ? JenisItem::KAMAR : JenisItem::LAYANAN;
+        return t->pasangItemDariFile(ItemBooking(jenis, fields[1].toString(), fields[2].toString(),
+                                                 harga, kuantitas, fields[6].toString(),
+                                                 fields[7].toString(),
+                                                 fieldCount > 8 ? fields[8].toString() : ""));
+    }
     
+    // Helper: Track max ID untuk auto-increment counter
+    void catatIdTransaksi(const PotonganString& id) {
+        int num;
+        if (id.mulaiDengan("T") && PengelolaFile::parseInt(id.dari(1), num)) {
+            if (num >= counterTransaksi) counterTransaksi = num + 1;
+        }
+    }
+    
+    // Helper: Catat perubahan status ke log, kompaksi jika log sudah panjang
+    bool catatStatus(Transaksi* t) {
+        bool berhasil;
+        
+        if (t->getStatus() == StatusTransaksi::CANCELLED) {
+            string fields[1] = { t->getIdTransaksi() };
+            berhasil = logTransaksi.tambahRecord("BATAL", fields, 1);
+        } else {
+            string fields[2] = { t->getIdTransaksi(), t->getStatusString() };
+            berhasil = logTransaksi.tambahRecord("STATUS", fields, 2);
+        }
+        
+        if (berhasil && logTransaksi.getJumlahRecord() >= BATAS_KOMPAKSI) {
+            return kompaksiLog();
+        }
+        return berhasil;
+    }
+    
+    // Helper: Tambah transaksi ke list & semua index
+    void tambahTransaksi(Transaksi* t) {
+        daftarTransaksi.tambah(t);
+        indexTransaksi.insert(t, t->getIdTransaksi());
+        
+        CircularLinkedList<Transaksi*>** riwayat = indexPelanggan.search(t->getIdPelanggan());
+        if (riwayat == nullptr) {
+            CircularLinkedList<Transaksi*>* riwayatBaru = new CircularLinkedList<Transaksi*>();
+            indexPelanggan.insert(riwayatBaru, t->getIdPelanggan());
+            riwayat = indexPelanggan.search(t->getIdPelanggan());
+        }
+        (*riwayat)->tambah(t);
+        catatAgregat(t, 1);
+    }
+    
+    // Helper: Tambah transaksi hasil load. ID yang sudah terpakai (data lama
+    // bisa berisi ID kembar) ditunda ke daftar duplikat, diberi ID baru lewat
+    // beriIdBaruDuplikat setelah semua ID di file tercatat
+    void tambahTransaksiTermuat(Transaksi* t, CircularLinkedList<Transaksi*>& duplikat) {
+        if (cariTransaksi(t->getIdTransaksi()) != nullptr) {
+            duplikat.tambah(t);
+            return;
+        }
+        tambahTransaksi(t);
+    }
+    
+    // Helper: Beri ID baru untuk transaksi duplikat lalu tulis ulang snapshot
+    // teks agar ID baru permanen (restart berikutnya tidak menomori ulang)
+    // Rincian item di file item tetap milik transaksi pertama dengan ID lama
+    void beriIdBaruDuplikat(CircularLinkedList<Transaksi*>& duplikat) {
+        if (duplikat.kosong()) return;
+        
+        duplikat.iterasi([&](Transaksi* t) {
+            string idBaru = generateIDTransaksi();
+            PengelolaFile::cetakBaris("[WARNING] ID transaksi " + t->getIdTransaksi() +
+                                      " ganda, diberi ID baru " + idBaru);
+            t->setIdTransaksi(idBaru);
+            tambahTransaksi(t);
+        });
+        duplikat.clear();
+        
+        if (!simpanSemuaTransaksi() || !logTransaksi.kosongkan()) {
+            PengelolaFile::cetakBaris("[ERROR] Gagal menyimpan ID transaksi baru!");
+        }
+    }
+    
+    // Helper: Status yang dihitung sebagai pendapatan
+    static bool isPendapatan(StatusTransaksi status) {
+        return status == StatusTransaksi::CONFIRMED || status == StatusTransaksi::COMPLETED;
+    }
+    
+    // Helper: Tambahkan (arah = 1) / kurangi (arah = -1) transaksi ke agregat
+    void catatAgregat(const Transaksi* t, int arah) {
+        agregat.perStatus[static_cast<int>(t->getStatus())] += arah;
+        if (isPendapatan(t->getStatus())) {
+            agregat.pendapatan += t->getTotalAkhir() * arah;
+        }
+        kubus.catat(t, arah);
+    }
+    
+    // Helper: Ubah status transaksi yang sudah terdaftar (agregat ikut)
+    void ubahStatus(Transaksi* t, StatusTransaksi statusBaru) {
+        catatAgregat(t, -1);
+        t->setStatus(statusBaru);
+        catatAgregat(t, 1);
+    }
+    
+    // Helper: Hitung ulang agregat dari semua transaksi
+    AgregatTransaksi hitungAgregat() const {
+        AgregatTransaksi hasil;
+        daftarTransaksi.iterasi([&](Transaksi* t) {
+            hasil.perStatus[static_cast<int>(t->getStatus())]++;
+            if (isPendapatan(t->getStatus())) hasil.pendapatan += t->getTotalAkhir();
+        });
+        return hasil;
+    }
+    
+    // Helper: func(nomorKamar, hariMulai, hariSelesai) untuk setiap item
+    // kamar transaksi yang tanggalnya valid
+    template<typename Function>
+    static void iterasiMalamKamar(const Transaksi* t, Function func) {
+        for (int i = 0; i < t->getJumlahItem(); i++) {
+            const ItemBooking* item = t->getItem(i);
+            if (item == nullptr || item->getJenis() != JenisItem::KAMAR) continue;
+            
+            int mulai, selesai;
+            if (KalenderKamar::parseRentang(item->getTanggalMulai(), item->getTanggalSelesai(),
+                                            mulai, selesai)) {
+                func(item->getIdItem(), mulai, selesai);
+            }
+        }
+    }
+    
+    // Helper: Pesan semua malam kamar transaksi baru di kalender
+    // Jika salah satu bentrok, yang sudah dipesan dilepas lagi (semua atau tidak)
+    bool pesanKamar(const Transaksi* t) {
+        if (kalender == nullptr) return true;
+        siapkanKalender();
+        
+        bool berhasil = true;
+        int jumlahDipesan = 0;
+        iterasiMalamKamar(t, [&](const string& nomor, int mulai, int selesai) {
+            if (!berhasil) return;
+            
+            if (kalender->pesan(nomor, mulai, selesai)) {
+                jumlahDipesan++;
+            } else {
+                cout << "[ERROR] Kamar " << nomor << " sudah dipesan pada tanggal tersebut!" << endl;
+                berhasil = false;
+            }
+        });
+        
+        if (!berhasil) {
+            iterasiMalamKamar(t, [&](const string& nomor, int mulai, int selesai) {
+                if (jumlahDipesan-- > 0) kalender->lepas(nomor, mulai, selesai);
+            });
+        }
+        return berhasil;
+    }
+
 public:
     // Constructor
     SistemPembayaran(const string& namaFile = "transaksi.txt")
-        : namaFileTransaksi(namaFile), counterTransaksi(1) {
+        : namaFileTransaksi(namaFile), logTransaksi(PengelolaFile::gantiEkstensi(namaFile, ".log")),
+          logItem(PengelolaFile::gantiEkstensi(namaFile, "_item.txt")), itemDimuat(false),
+          kalender(nullptr), kalenderSiap(false), counterTransaksi(1) {
         PengelolaFile::buatFileJikaBelumAda(namaFileTransaksi);
     }
     
@@ -35,6 +333,9 @@ public:
         daftarTransaksi.iterasi([](Transaksi* t) {
             delete t;
         });
+        indexPelanggan.iterasi([](CircularLinkedList<Transaksi*>* riwayat) {
+            delete riwayat;
+        });
     }
     
     // Proses pembayaran
@@ -44,6 +345,15 @@ public:
             return false;
         }
         
+        // Cek & pesan malam kamar sebelum pembayaran diproses
+        if (!pesanKamar(transaksi)) {
+            cout << "[ERROR] Pembayaran dibatalkan, silakan pilih tanggal/kamar lain." << endl;
+            return false;
+        }
+        
+        // ID baru dibuat setelah kamar berhasil dipesan
+        transaksi->setIdTransaksi(generateIDTransaksi());
+        
         // Set metode pembayaran
         transaksi->setMetodeBayar(metode);
         
@@ -68,9 +378,9 @@ public:
         transaksi->setStatus(StatusTransaksi::CONFIRMED);
         
         // Simpan transaksi
-        daftarTransaksi.tambah(transaksi);
+        tambahTransaksi(transaksi);
         
-        // Simpan ke file
+        // Catat ke log (append 1 record, snapshot tidak ditulis ulang)
         simpanTransaksi(transaksi);
         
         // Push ke history stack
@@ -95,137 +405,236 @@ public:
         cout << "\nStruk telah ditampilkan. ID Transaksi: " << transaksi->getIdTransaksi() << endl;
     }
     
-    // Simpan transaksi ke file (append)
+    // Simpan transaksi baru (append record BUAT ke log, lalu item-itemnya)
+    // BUAT ditulis lebih dulu: jika crash di antaranya, transaksi tetap ada
+    // hanya tanpa rincian item (tidak pernah ada item tanpa transaksi)
     bool simpanTransaksi(Transaksi* transaksi) {
         if (transaksi == nullptr) return false;
         
-        // Format: ID|IDPelanggan|NamaPelanggan|Status|TotalAkhir|Tanggal|JumlahItem
-        string fields[10];
-        fields[0] = transaksi->getIdTransaksi();
-        fields[1] = transaksi->getIdPelanggan();
-        fields[2] = transaksi->getNamaPelanggan();
-        fields[3] = transaksi->getStatusString();
-        fields[4] = to_string(static_cast<long long>(transaksi->getTotalAkhir()));
-        fields[5] = transaksi->getTanggalTransaksi();
-        fields[6] = to_string(transaksi->getJumlahItem());
-        fields[7] = transaksi->getMetodeBayarString();
-        fields[8] = transaksi->getTanggalCheckIn();
-        fields[9] = transaksi->getTanggalCheckOut();
-        
-        string line = PengelolaFile::gabungField(fields, 10);
+        string fields[1] = { formatBarisTransaksi(transaksi) };
+        if (!logTransaksi.tambahRecord("BUAT", fields, 1)) return false;
         
-        return PengelolaFile::tambahBaris(namaFileTransaksi, line);
+        bool berhasil = true;
+        for (int i = 0; i < transaksi->getJumlahItem(); i++) {
+            const ItemBooking* item = transaksi->getItem(i);
+            if (item == nullptr) continue;
+            
+            string fieldItem[2] = { transaksi->getIdTransaksi(), item->toFileFormat() };
+            berhasil = logItem.tambahRecord("ITEM", fieldItem, 2) && berhasil;
+        }
+        return berhasil;
     }
     
-    // Simpan SEMUA transaksi ke file (untuk update/sync)
-    bool simpanSemuaTransaksi() {
-        string baris[1000];
-        int jumlah = 0;
-        
-        daftarTransaksi.iterasi([&](Transaksi* t) {
-            if (jumlah >= 1000) return; // Safety limit
+    // Muat item booking semua transaksi dari transaksi_item.txt (sekali saja)
+    // Item ditambahkan ke transaksi yang dimuat dari file, transaksi
+    // yang dibuat di sesi ini sudah punya item lengkap sehingga dilewati
+    void muatItemTransaksi() {
+        if (itemDimuat) return;
+        itemDimuat = true;
+        
+        logItem.putarUlang([&](const PotonganString fields[], int fieldCount) {
+            if (fields[0] != "ITEM" || fieldCount < 3) return;
             
-            string fields[10];
-            fields[0] = t->getIdTransaksi();
-            fields[1] = t->getIdPelanggan();
-            fields[2] = t->getNamaPelanggan();
-            fields[3] = t->getStatusString();
-            fields[4] = to_string(static_cast<long long>(t->getTotalAkhir()));
-            fields[5] = t->getTanggalTransaksi();
-            fields[6] = to_string(t->getJumlahItem());
-            fields[7] = t->getMetodeBayarString();
-            fields[8] = t->getTanggalCheckIn();
-            fields[9] = t->getTanggalCheckOut();
+            Transaksi* t = cariTransaksi(fields[1].toString());
+            if (t == nullptr || t->isItemLengkap()) return;
             
-            baris[jumlah] = PengelolaFile::gabungField(fields, 10);
-            jumlah++;
+            pasangItem(t, fields + 2, fieldCount - 2);
         });
         
-        return PengelolaFile::tulisSemuaBaris(namaFileTransaksi, baris, jumlah);
+        // Transaksi lama sebelumnya tercatat tanpa rincian item
+        kubus.clear();
+        daftarTransaksi.iterasi([&](Transaksi* t) {
+            kubus.catat(t, 1);
+        });
     }
     
-    // Load semua transaksi dari file
-    bool muatDataTransaksi() {
-        string baris[1000];
-        int jumlah = PengelolaFile::bacaSemuaBaris(namaFileTransaksi, baris, 1000);
-        
-        if (jumlah == 0) {
-            return true; // File kosong, tidak perlu print
+    // Hubungkan kalender kamar (dari ManajemenKamar)
+    void setKalender(KalenderKamar* _kalender) {
+        kalender = _kalender;
+        kalenderSiap = false;
+    }
+    
+    // Isi kalender dari item kamar semua transaksi yang tidak dibatalkan
+    // (sekali saja, item transaksi ikut dimuat). Data lama yang tumpang
+    // tindih tetap ditandai apa adanya
+    void siapkanKalender() {
+        if (kalender == nullptr || kalenderSiap) return;
+        kalenderSiap = true;
+        
+        muatItemTransaksi();
+        kalender->clear();
+        daftarTransaksi.iterasi([&](Transaksi* t) {
+            if (t->getStatus() == StatusTransaksi::CANCELLED) return;
+            
+            iterasiMalamKamar(t, [&](const string& nomor, int mulai, int selesai) {
+                kalender->tandai(nomor, mulai, selesai);
+            });
+        });
+    }
+    
+    // Simpan SEMUA transaksi ke file snapshot (dipakai oleh kompaksi)
+    bool simpanSemuaTransaksi() {
+        return PengelolaFile::tulisPerBaris(namaFileTransaksi, [&](PenulisFile& penulis) {
+            daftarTransaksi.iterasi([&](Transaksi* t) {
+                penulis.tulisBaris(formatBarisTransaksi(t));
+            });
+        });
+    }
+    
+    // Kompaksi: tulis ulang snapshot dari memori lalu kosongkan log
+    // Jika crash di antara keduanya, replay tetap aman (BUAT yang ID-nya
+    // sudah ada di snapshot dilewati, STATUS/BATAL idempoten)
+    bool kompaksiLog() {
+        if (logTransaksi.getJumlahRecord() == 0) return true;
+        
+        if (!simpanSemuaTransaksi()) {
+            cout << "[ERROR] Gagal menulis snapshot transaksi!" << endl;
+            return false;
         }
         
-        int maxId = 0;
-        int loaded = 0;
-        
-        // Parse dan load setiap transaksi
-        for (int i = 0; i < jumlah; i++) {
-            string fields[15];
-            int fieldCount;
-            PengelolaFile::split(baris[i], '|', fields, fieldCount);
-            
-            if (fieldCount < 9) continue; // Skip baris yang tidak valid
-            
-            // Parse fields: ID|IDPelanggan|Nama|Status|Total|Tanggal|JumlahItem|Metode|CheckIn|CheckOut
-            string id = PengelolaFile::trim(fields[0]);
-            string idPelanggan = PengelolaFile::trim(fields[1]);
-            string namaPelanggan = PengelolaFile::trim(fields[2]);
-            string statusStr = PengelolaFile::trim(fields[3]);
-            double total = stod(PengelolaFile::trim(fields[4]));
-            string tanggal = PengelolaFile::trim(fields[5]);
-            int jumlahItem = stoi(PengelolaFile::trim(fields[6]));
-            string metodeStr = PengelolaFile::trim(fields[7]);
-            string checkIn = (fieldCount > 8) ? PengelolaFile::trim(fields[8]) : "";
-            string checkOut = (fieldCount > 9) ? PengelolaFile::trim(fields[9]) : "";
-            
-            // Parse status
-            StatusTransaksi status = StatusTransaksi::PENDING;
-            if (statusStr == "CONFIRMED") status = StatusTransaksi::CONFIRMED;
-            else if (statusStr == "COMPLETED") status = StatusTransaksi::COMPLETED;
-            else if (statusStr == "CANCELLED") status = StatusTransaksi::CANCELLED;
-            
-            // Parse metode pembayaran
-            MetodePembayaran metode = MetodePembayaran::TUNAI;
-            if (metodeStr == "TRANSFER_BANK") metode = MetodePembayaran::TRANSFER_BANK;
-            else if (metodeStr == "KARTU_KREDIT") metode = MetodePembayaran::KARTU_KREDIT;
-            else if (metodeStr == "EWALLET") metode = MetodePembayaran::EWALLET;
-            
-            // Buat transaksi baru dengan constructor yang benar (4 params)
-            Transaksi* t = new Transaksi(id, idPelanggan, namaPelanggan, tanggal);
-            t->setStatus(status);
-            t->setTanggalCheckIn(checkIn);
-            t->setTanggalCheckOut(checkOut);
-            t->setJumlahItemDariFile(jumlahItem);
-            t->setMetodeBayar(metode);
-            
-            // ? SET TOTAL DARI FILE! (CRITICAL FIX)
-            // Total dari file sudah include PPN + Service
-            // Reverse calculate: total = subtotal * 1.15
-            double subtotal = total / 1.15;
-            double ppn = subtotal * 0.10;
-            double service = subtotal * 0.05;
-            t->setTotalDariFile(subtotal, ppn, service, total);
-            
-            // Tambahkan ke daftar
-            daftarTransaksi.tambah(t);
-            loaded++;
+        return logTransaksi.kosongkan();
+    }
+    
+    // Kosongkan log & file item tanpa menulis snapshot (untuk reset data)
+    bool kosongkanLog() {
+        bool berhasil = logTransaksi.kosongkan();
+        return logItem.kosongkan() && berhasil;
+    }
+    
+    // Load semua transaksi dari snapshot, lalu putar ulang log
+    // jumlahThread > 1: transaksi.txt dibagi per potongan yang di-parse
+    // bersamaan, hasilnya digabung sesuai urutan di file
+    bool muatDataTransaksi(int jumlahThread = 1) {
+        CircularLinkedList<Transaksi*> duplikat;
+        
+        // 1. Snapshot
+        if (jumlahThread > 1) {
+            CircularLinkedList<Transaksi*>* hasilBagian = new CircularLinkedList<Transaksi*>[jumlahThread];
             
-            // ? FIX COUNTER - Track max ID untuk auto-increment
-            if (id.length() > 1 && id[0] == 'T') {
-                try {
-                    int num = stoi(id.substr(1));
-                    if (num > maxId) maxId = num;
-                } catch (...) {
-                    // Skip jika parse gagal
+            int total;
+            try {
+                total = PengelolaFile::bacaPerBarisParalel(namaFileTransaksi, jumlahThread,
+                    [&](int bagian, const string& baris) {
+                        PotonganString fields[15];
+                        int fieldCount;
+                        PengelolaFile::splitPotongan(baris, '|', fields, 15, fieldCount);
+                        
+                        Transaksi* t = parseTransaksi(fields, fieldCount);
+                        if (t != nullptr) hasilBagian[bagian].tambah(t);
+                    });
+            } catch (...) {
+                // Exception dari thread parse: buang hasil parsial lalu teruskan
+                for (int i = 0; i < jumlahThread; i++) {
+                    hasilBagian[i].iterasi([](Transaksi* t) { delete t; });
                 }
+                delete[] hasilBagian;
+                throw;
+            }
+            
+            // Gabung (single thread): list & index tidak thread-safe
+            indexTransaksi.reservasi(total);
+            for (int i = 0; i < jumlahThread; i++) {
+                hasilBagian[i].iterasi([&](Transaksi* t) {
+                    tambahTransaksiTermuat(t, duplikat);
+                    catatIdTransaksi(PotonganString(t->getIdTransaksi()));
+                });
             }
+            
+            delete[] hasilBagian;
+        } else {
+            PengelolaFile::bacaPerBaris(namaFileTransaksi, [&](const string& baris) {
+                PotonganString fields[15];
+                int fieldCount;
+                PengelolaFile::splitPotongan(baris, '|', fields, 15, fieldCount);
+                
+                Transaksi* t = parseTransaksi(fields, fieldCount);
+                if (t == nullptr) return;
+                
+                // Tambahkan ke daftar
+                tambahTransaksiTermuat(t, duplikat);
+                catatIdTransaksi(fields[0]);
+            });
         }
         
-        // ? SET COUNTER PROPERLY
-        counterTransaksi = maxId + 1;
+        // 2. Log perubahan sejak kompaksi terakhir (urutan = urutan kejadian)
+        logTransaksi.putarUlang([&](const PotonganString fields[], int fieldCount) {
+            if (fields[0] == "BUAT") {
+                // Sudah ada di snapshot (crash saat kompaksi): lewati
+                if (fieldCount < 2 || cariTransaksi(fields[1].toString()) != nullptr) return;
+                
+                Transaksi* t = parseTransaksi(fields + 1, fieldCount - 1);
+                if (t == nullptr) return;
+                
+                tambahTransaksi(t);
+                catatIdTransaksi(fields[1]);
+            } else if (fields[0] == "STATUS" && fieldCount >= 3) {
+                Transaksi* t = cariTransaksi(fields[1].toString());
+                if (t != nullptr) ubahStatus(t, parseStatus(fields[2]));
+            } else if (fields[0] == "BATAL" && fieldCount >= 2) {
+                Transaksi* t = cariTransaksi(fields[1].toString());
+                if (t != nullptr) ubahStatus(t, StatusTransaksi::CANCELLED);
+            }
+        });
+        
+        // 3. ID kembar dinomori ulang setelah ID terbesar diketahui
+        beriIdBaruDuplikat(duplikat);
         
         // Silent load - tidak perlu print
         return true;
     }
     
+    // Byte per record transaksi di snapshot biner
+    static const size_t LEBAR_RECORD_SNAPSHOT = 2 * sizeof(uint8_t) + sizeof(int32_t) +
+                                                sizeof(int64_t) + 6 * sizeof(uint32_t);
+    
+    // Tulis semua transaksi ke snapshot biner
+    // Record: status, metode, jumlahItem, total, id, idPelanggan, nama,
+    //         tanggal, checkIn, checkOut
+    void tulisSnapshot(PenulisSnapshot& snapshot) const {
+        snapshot.setJumlahData(BagianSnapshot::TRANSAKSI, daftarTransaksi.ukuran());
+        
+        daftarTransaksi.iterasi([&](Transaksi* t) {
+            snapshot.tulis<uint8_t>(static_cast<uint8_t>(t->getStatus()));
+            snapshot.tulis<uint8_t>(static_cast<uint8_t>(t->getMetodeBayar()));
+            snapshot.tulis<int32_t>(t->getJumlahItem());
+            snapshot.tulis<int64_t>(t->getTotalAkhir().getSen());
+            snapshot.tulisString(t->getIdTransaksi());
+            snapshot.tulisString(t->getIdPelanggan());
+            snapshot.tulisString(t->getNamaPelanggan());
+            snapshot.tulisString(t->getTanggalTransaksi());
+            snapshot.tulisString(t->getTanggalCheckIn());
+            snapshot.tulisString(t->getTanggalCheckOut());
+        });
+    }
+    
+    // Load transaksi dari snapshot biner (sudah divalidasi oleh PembacaSnapshot)
+    bool muatSnapshot(PembacaSnapshot& snapshot) {
+        uint32_t jumlah = snapshot.getJumlahData(BagianSnapshot::TRANSAKSI);
+        indexTransaksi.reservasi(jumlah);
+        CircularLinkedList<Transaksi*> duplikat;
+        
+        for (uint32_t i = 0; i < jumlah; i++) {
+            StatusTransaksi status = static_cast<StatusTransaksi>(snapshot.baca<uint8_t>());
+            MetodePembayaran metode = static_cast<MetodePembayaran>(snapshot.baca<uint8_t>());
+            int jumlahItem = snapshot.baca<int32_t>();
+            Rupiah total = Rupiah::dariSen(snapshot.baca<int64_t>());
+            const string& id = snapshot.bacaString();
+            const string& idPelanggan = snapshot.bacaString();
+            const string& nama = snapshot.bacaString();
+            const string& tanggal = snapshot.bacaString();
+            const string& checkIn = snapshot.bacaString();
+            const string& checkOut = snapshot.bacaString();
+            
+            tambahTransaksiTermuat(buatTransaksi(id, idPelanggan, nama, tanggal, status, metode,
+                                                 checkIn, checkOut, jumlahItem, total),
+                                   duplikat);
+            catatIdTransaksi(PotonganString(id));
+        }
+        
+        beriIdBaruDuplikat(duplikat);
+        return !snapshot.gagal();
+    }
+    
     // Lihat history transaksi (menggunakan Stack)
     void tampilkanHistoryPembayaran() const {
         cout << "\n+------------------------------------------------------------+" << endl;
@@ -240,18 +649,18 @@ public:
         historyPembayaran.tampilkan();
     }
     
-    // Lihat semua transaksi customer
+    // Lihat semua transaksi customer (lewat index pelanggan)
     void tampilkanTransaksiCustomer(const string& idPelanggan) const {
-        bool found = false;
         int nomor = 1;
         
         cout << "\n+------------------------------------------------------------+" << endl;
         cout << "          RIWAYAT TRANSAKSI                                 " << endl;
         cout << "+------------------------------------------------------------+" << endl;
         
-        daftarTransaksi.iterasi([&](Transaksi* t) {
-            if (t->getIdPelanggan() == idPelanggan) {
-                found = true;
+        CircularLinkedList<Transaksi*>* const* riwayat = indexPelanggan.search(idPelanggan);
+        
+        if (riwayat != nullptr) {
+            (*riwayat)->iterasi([&](Transaksi* t) {
                 cout << "\n[" << nomor++ << "] " << t->getIdTransaksi() << endl;
                 cout << "Tanggal     : " << t->getTanggalTransaksi() << endl;
                 cout << "Status      : " << t->getStatusString() << endl;
@@ -259,10 +668,10 @@ public:
                 cout << "Total Bayar : " << PengelolaFile::formatRupiahLengkap(t->getTotalAkhir()) << endl;
                 cout << "Metode Bayar: " << t->getMetodeBayarString() << endl;
                 cout << "-----------------------------------------------------------" << endl;
-            }
-        });
+            });
+        }
         
-        if (!found) {
+        if (riwayat == nullptr || (*riwayat)->kosong()) {
             cout << "\n[INFO] Belum ada transaksi." << endl;
         }
     }
@@ -291,23 +700,35 @@ public:
     
     // Update status transaksi (untuk pegawai)
     bool updateStatusTransaksi(const string& idTransaksi, StatusTransaksi statusBaru) {
-        Transaksi* transaksi = nullptr;
-        
-        daftarTransaksi.iterasi([&](Transaksi* t) {
-            if (t->getIdTransaksi() == idTransaksi) {
-                transaksi = t;
-            }
-        });
+        Transaksi* transaksi = cariTransaksi(idTransaksi);
         
         if (transaksi == nullptr) {
             cout << "[ERROR] Transaksi dengan ID " << idTransaksi << " tidak ditemukan!" << endl;
             return false;
         }
         
-        transaksi->setStatus(statusBaru);
+        // Pembatalan melepas malam kamar di kalender. Mengaktifkan kembali
+        // transaksi batal memesan ulang semua kamarnya (semua atau tidak),
+        // ditolak jika malamnya sudah dipesan transaksi lain
+        bool batalLama = transaksi->getStatus() == StatusTransaksi::CANCELLED;
+        bool batalBaru = statusBaru == StatusTransaksi::CANCELLED;
+        if (batalLama && !batalBaru) {
+            if (!pesanKamar(transaksi)) {
+                cout << "[ERROR] Status transaksi " << idTransaksi << " tidak diubah." << endl;
+                return false;
+            }
+        } else if (!batalLama && batalBaru && kalenderSiap) {
+            iterasiMalamKamar(transaksi, [&](const string& nomor, int mulai, int selesai) {
+                kalender->lepas(nomor, mulai, selesai);
+            });
+        }
         
-        // ? AUTO SAVE TO FILE AFTER UPDATE! (CRITICAL FIX)
-        simpanSemuaTransaksi();
+        ubahStatus(transaksi, statusBaru);
+        
+        // Catat ke log (1 record), bukan menulis ulang seluruh transaksi.txt
+        if (!catatStatus(transaksi)) {
+            cout << "[ERROR] Gagal menyimpan perubahan status!" << endl;
+        }
         
         cout << "[SUKSES] Status transaksi " << idTransaksi << " diubah menjadi: " 
              << transaksi->getStatusString() << endl;
@@ -322,25 +743,20 @@ public:
             return;
         }
         
-        double totalPendapatan = 0.0;
-        int totalTransaksiSelesai = 0;
-        int totalTransaksiPending = 0;
-        int totalTransaksiBatal = 0;
+        // Agregat incremental - O(1)
+#ifdef PERIKSA_STATISTIK
+        if (!periksaKonsistensi()) {
+            cout << "[ERROR] Agregat transaksi tidak sama dengan hitung ulang!" << endl;
+        }
+#endif
         
-        daftarTransaksi.iterasi([&](Transaksi* t) {
-            if (t->getStatus() == StatusTransaksi::CONFIRMED || 
-                t->getStatus() == StatusTransaksi::COMPLETED) {
-                totalPendapatan += t->getTotalAkhir();
-                totalTransaksiSelesai++;
-            } else if (t->getStatus() == StatusTransaksi::PENDING) {
-                totalTransaksiPending++;
-            } else if (t->getStatus() == StatusTransaksi::CANCELLED) {
-                totalTransaksiBatal++;
-            }
-        });
+        Rupiah totalPendapatan = agregat.pendapatan;
+        int totalTransaksiSelesai = agregat.perStatus[static_cast<int>(StatusTransaksi::CONFIRMED)] +
+                                    agregat.perStatus[static_cast<int>(StatusTransaksi::COMPLETED)];
+        int totalTransaksiPending = agregat.perStatus[static_cast<int>(StatusTransaksi::PENDING)];
+        int totalTransaksiBatal = agregat.perStatus[static_cast<int>(StatusTransaksi::CANCELLED)];
         
-        double rataRataTransaksi = (totalTransaksiSelesai > 0) ? 
-                                    totalPendapatan / totalTransaksiSelesai : 0.0;
+        Rupiah rataRataTransaksi = totalPendapatan.bagi(totalTransaksiSelesai);
         
         cout << "\n+------------------------------------------------------------+" << endl;
         cout << "          STATISTIK KEUANGAN                                " << endl;
@@ -357,6 +773,22 @@ public:
         cout << "+------------------------------------------------------------+" << endl;
     }
     
+    // Cocokkan agregat incremental dengan hitung ulang dari nol
+    bool periksaKonsistensi() const {
+        return hitungAgregat() == agregat;
+    }
+    
+    // Get agregat transaksi (jumlah per status & pendapatan) - O(1)
+    const AgregatTransaksi& getAgregat() const {
+        return agregat;
+    }
+    
+    // Cari transaksi by ID - O(1)
+    Transaksi* cariTransaksi(const string& idTransaksi) {
+        Transaksi** found = indexTransaksi.search(idTransaksi);
+        return (found != nullptr) ? *found : nullptr;
+    }
+    
     // Generate ID transaksi baru
     string generateIDTransaksi() {
         return "T" + PengelolaFile::generateID("", counterTransaksi++);
@@ -366,6 +798,11 @@ public:
     CircularLinkedList<Transaksi*>& getDaftarTransaksi() {
         return daftarTransaksi;
     }
+    
+    // Get rekap pendapatan harian (item belum tentu dimuat, lihat muatItemTransaksi)
+    KubusPendapatan& getKubusPendapatan() {
+        return kubus;
+    }
 };
 
 #endif
@@ -0,0 +1,389 @@
+#ifndef SNAPSHOT_BINER_H
+#define SNAPSHOT_BINER_H
+
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include "TabelHash.h"
+#include "PengelolaFile.h"
+using namespace std;
+
+// ============================================================================
+// SNAPSHOT BINER - CACHE CEPAT UNTUK COLD START
+// ============================================================================
+// Salinan biner semua data (pengguna, kamar, layanan, transaksi) yang ditulis
+// saat keluar program. File teks tetap menjadi sumber utama; snapshot hanya
+// dipakai jika ukuran & waktu ubah semua file sumber masih sama
+// Layout file:
+//   [HeaderSnapshot] [InfoSumber x jumlahSumber]
+//   [panjang string (uint32) x jumlahString] [isi semua string]
+//   [record pengguna] [record kamar] [record layanan] [record transaksi]
+// - Setiap record fixed-width: angka disimpan biner, string sebagai index
+//   uint32 ke tabel string (string yang sama hanya disimpan sekali)
+// - Checksum FNV-1a 64-bit atas semua byte setelah header (per segmen)
+// - Byte order mengikuti mesin (snapshot adalah cache lokal, bukan format tukar)
+// ============================================================================
+
+enum class BagianSnapshot {
+    PENGGUNA,
+    KAMAR,
+    LAYANAN,
+    TRANSAKSI
+};
+
+const int JUMLAH_BAGIAN_SNAPSHOT = 4;
+// Versi 2: nominal uang (harga, total) disimpan dalam sen, bukan Rupiah
+const uint32_t VERSI_SNAPSHOT = 2;
+const char MAGIC_SNAPSHOT[8] = { 'H', 'T', 'L', 'S', 'N', 'A', 'P', '\0' };
+
+struct HeaderSnapshot {
+    char magic[8];
+    uint32_t versi;
+    uint32_t jumlahSumber;
+    uint32_t jumlahString;
+    uint32_t jumlahData[JUMLAH_BAGIAN_SNAPSHOT];
+    uint32_t cadangan;      // Padding agar field 64-bit rata 8 byte
+    uint64_t ukuranString;  // Byte tabel string (panjang + isi)
+    uint64_t ukuranBodi;    // Byte semua record
+    uint64_t checksum;
+};
+
+// Ukuran & waktu ubah file teks saat snapshot ditulis
+struct InfoSumber {
+    int64_t ukuran;
+    int64_t waktuUbah;
+};
+
+// Helper: Checksum FNV-1a 64-bit, diproses per 8 byte
+inline uint64_t checksumSnapshot(uint64_t hash, const char* data, size_t panjang) {
+    const uint64_t PRIMA = 1099511628211ULL;
+    
+    while (panjang >= 8) {
+        uint64_t kata;
+        memcpy(&kata, data, 8);
+        hash = (hash ^ kata) * PRIMA;
+        data += 8;
+        panjang -= 8;
+    }
+    
+    while (panjang > 0) {
+        hash = (hash ^ (unsigned char)*data) * PRIMA;
+        data++;
+        panjang--;
+    }
+    
+    return hash;
+}
+
+const uint64_t CHECKSUM_AWAL = 14695981039346656037ULL;
+
+// ============================================================================
+// PENULIS SNAPSHOT
+// ============================================================================
+// Record ditulis berurutan per bagian (PENGGUNA, KAMAR, LAYANAN, TRANSAKSI)
+// Contoh:
+//   snapshot.setJumlahData(BagianSnapshot::KAMAR, n);
+//   snapshot.tulis<uint8_t>(tipe); snapshot.tulisString(nomor); ...
+// ============================================================================
+
+class PenulisSnapshot {
+private:
+    TabelHash<uint32_t> indexString; // Interning: string -> index tabel
+    string panjangString;            // uint32 per string
+    string isiString;
+    string bodi;
+    uint32_t jumlahString;
+    uint32_t jumlahData[JUMLAH_BAGIAN_SNAPSHOT];
+
+public:
+    // Constructor
+    PenulisSnapshot() : jumlahString(0) {
+        for (int i = 0; i < JUMLAH_BAGIAN_SNAPSHOT; i++) {
+            jumlahData[i] = 0;
+        }
+    }
+    
+    PenulisSnapshot(const PenulisSnapshot&) = delete;
+    PenulisSnapshot& operator=(const PenulisSnapshot&) = delete;
+    
+    // Index string di tabel (ditambahkan jika belum ada)
+    uint32_t intern(const string& teks) {
+        uint32_t* found = indexString.search(teks);
+        if (found != nullptr) return *found;
+        
+        uint32_t panjang = (uint32_t)teks.length();
+        panjangString.append((const char*)&panjang, sizeof(panjang));
+        isiString += teks;
+        indexString.insert(jumlahString, teks);
+        
+        return jumlahString++;
+    }
+    
+    // Tulis satu nilai fixed-width (uint8_t, int32_t, int64_t, ...)
+    template<typename T>
+    void tulis(T nilai) {
+        bodi.append((const char*)&nilai, sizeof(T));
+    }
+    
+    // Tulis string sebagai index ke tabel string
+    void tulisString(const string& teks) {
+        tulis<uint32_t>(intern(teks));
+    }
+    
+    // Jumlah record suatu bagian (dipanggil sebelum record bagian itu ditulis)
+    void setJumlahData(BagianSnapshot bagian, uint32_t jumlah) {
+        jumlahData[static_cast<int>(bagian)] = jumlah;
+    }
+    
+    // Tulis snapshot ke file beserta info file-file sumbernya
+    bool simpan(const string& namaFile, const string sumber[], int jumlahSumber) {
+        InfoSumber* info = new InfoSumber[jumlahSumber];
+        for (int i = 0; i < jumlahSumber; i++) {
+            long long ukuran, waktuUbah;
+            PengelolaFile::infoFile(sumber[i], ukuran, waktuUbah);
+            info[i].ukuran = ukuran;
+            info[i].waktuUbah = waktuUbah;
+        }
+        
+        HeaderSnapshot header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, MAGIC_SNAPSHOT, sizeof(header.magic));
+        header.versi = VERSI_SNAPSHOT;
+        header.jumlahSumber = (uint32_t)jumlahSumber;
+        header.jumlahString = jumlahString;
+        for (int i = 0; i < JUMLAH_BAGIAN_SNAPSHOT; i++) {
+            header.jumlahData[i] = jumlahData[i];
+        }
+        header.ukuranString = panjangString.length() + isiString.length();
+        header.ukuranBodi = bodi.length();
+        
+        uint64_t hash = CHECKSUM_AWAL;
+        hash = checksumSnapshot(hash, (const char*)info, sizeof(InfoSumber) * jumlahSumber);
+        hash = checksumSnapshot(hash, panjangString.data(), panjangString.length());
+        hash = checksumSnapshot(hash, isiString.data(), isiString.length());
+        hash = checksumSnapshot(hash, bodi.data(), bodi.length());
+        header.checksum = hash;
+        
+        FILE* file = fopen(namaFile.c_str(), "wb");
+        if (file == nullptr) {
+            cout << "[ERROR] Tidak dapat menulis snapshot: " << namaFile << endl;
+            delete[] info;
+            return false;
+        }
+        
+        bool berhasil =
+            fwrite(&header, sizeof(header), 1, file) == 1 &&
+            fwrite(info, sizeof(InfoSumber), jumlahSumber, file) == (size_t)jumlahSumber &&
+            fwrite(panjangString.data(), 1, panjangString.length(), file) == panjangString.length() &&
+            fwrite(isiString.data(), 1, isiString.length(), file) == isiString.length() &&
+            fwrite(bodi.data(), 1, bodi.length(), file) == bodi.length();
+        
+        if (fclose(file) != 0) berhasil = false;
+        delete[] info;
+        
+        if (!berhasil) {
+            cout << "[ERROR] Gagal menulis snapshot: " << namaFile << endl;
+            PengelolaFile::hapusFile(namaFile);
+        }
+        
+        return berhasil;
+    }
+};
+
+// ============================================================================
+// PEMBACA SNAPSHOT
+// ============================================================================
+// buka() membaca seluruh file dengan satu fread lalu memvalidasi header,
+// file sumber, checksum & ukuran record sebelum data apa pun dimuat
+// Record dibaca berurutan dengan urutan yang sama seperti saat ditulis
+// ============================================================================
+
+class PembacaSnapshot {
+private:
+    char* buffer;
+    HeaderSnapshot header;
+    string* daftarString;
+    const char* posisi;
+    const char* akhir;
+    bool gagalBaca;
+    
+    // Helper: Bebaskan buffer & tabel string
+    void tutup() {
+        delete[] buffer;
+        delete[] daftarString;
+        buffer = nullptr;
+        daftarString = nullptr;
+        posisi = nullptr;
+        akhir = nullptr;
+    }
+    
+    // Helper: Cek file sumber tidak berubah sejak snapshot ditulis
+    static bool sumberMasihSama(const InfoSumber* info, const string sumber[], int jumlahSumber) {
+        for (int i = 0; i < jumlahSumber; i++) {
+            long long ukuran, waktuUbah;
+            PengelolaFile::infoFile(sumber[i], ukuran, waktuUbah);
+            
+            if (info[i].ukuran != ukuran || info[i].waktuUbah != waktuUbah) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    // Constructor
+    PembacaSnapshot()
+        : buffer(nullptr), daftarString(nullptr), posisi(nullptr),
+          akhir(nullptr), gagalBaca(false) {
+        memset(&header, 0, sizeof(header));
+    }
+    
+    // Destructor
+    ~PembacaSnapshot() {
+        tutup();
+    }
+    
+    PembacaSnapshot(const PembacaSnapshot&) = delete;
+    PembacaSnapshot& operator=(const PembacaSnapshot&) = delete;
+    
+    // Buka & validasi snapshot. lebarRecord[i] = byte per record bagian i
+    // Return false jika file tidak ada, basi, atau rusak (pakai file teks)
+    bool buka(const string& namaFile, const string sumber[], int jumlahSumber,
+              const size_t lebarRecord[JUMLAH_BAGIAN_SNAPSHOT]) {
+        tutup();
+        
+        long long ukuranFile, waktuUbah;
+        PengelolaFile::infoFile(namaFile, ukuranFile, waktuUbah);
+        if (ukuranFile < (long long)sizeof(HeaderSnapshot)) return false;
+        
+        FILE* file = fopen(namaFile.c_str(), "rb");
+        if (file == nullptr) return false;
+        
+        buffer = new char[ukuranFile];
+        bool terbaca = fread(buffer, 1, ukuranFile, file) == (size_t)ukuranFile;
+        fclose(file);
+        
+        memcpy(&header, buffer, sizeof(header));
+        
+        if (!terbaca || memcmp(header.magic, MAGIC_SNAPSHOT, sizeof(header.magic)) != 0 ||
+            header.versi != VERSI_SNAPSHOT || header.jumlahSumber != (uint32_t)jumlahSumber) {
+            cout << "[INFO] Format snapshot tidak dikenal, memuat dari file teks..." << endl;
+            tutup();
+            return false;
+        }
+        
+        // Ukuran total harus persis sama dengan yang tercatat di header
+        uint64_t ukuranSumber = sizeof(InfoSumber) * (uint64_t)jumlahSumber;
+        uint64_t ukuranHarusnya = sizeof(HeaderSnapshot) + ukuranSumber +
+                                  header.ukuranString + header.ukuranBodi;
+        
+        uint64_t ukuranRecord = 0;
+        for (int i = 0; i < JUMLAH_BAGIAN_SNAPSHOT; i++) {
+            ukuranRecord += (uint64_t)header.jumlahData[i] * lebarRecord[i];
+        }
+        
+        uint64_t ukuranPanjang = (uint64_t)header.jumlahString * sizeof(uint32_t);
+        const char* awalData = buffer + sizeof(HeaderSnapshot);
+        
+        bool valid = ukuranHarusnya == (uint64_t)ukuranFile &&
+                     ukuranRecord == header.ukuranBodi &&
+                     ukuranPanjang <= header.ukuranString;
+        
+        // Checksum dihitung per segmen, sama seperti saat ditulis
+        if (valid) {
+            const char* segmen = awalData;
+            uint64_t ukuranSegmen[4] = { ukuranSumber, ukuranPanjang,
+                                         header.ukuranString - ukuranPanjang, header.ukuranBodi };
+            uint64_t hash = CHECKSUM_AWAL;
+            for (int i = 0; i < 4; i++) {
+                hash = checksumSnapshot(hash, segmen, ukuranSegmen[i]);
+                segmen += ukuranSegmen[i];
+            }
+            valid = (hash == header.checksum);
+        }
+        
+        if (!valid) {
+            cout << "[ERROR] Snapshot rusak, memuat dari file teks..." << endl;
+            tutup();
+            return false;
+        }
+        
+        InfoSumber* info = new InfoSumber[jumlahSumber];
+        memcpy(info, awalData, ukuranSumber);
+        bool masihSama = sumberMasihSama(info, sumber, jumlahSumber);
+        delete[] info;
+        
+        if (!masihSama) {
+            cout << "[INFO] Data berubah sejak snapshot terakhir, memuat dari file teks..." << endl;
+            tutup();
+            return false;
+        }
+        
+        // Tabel string: setiap string unik dialokasikan sekali di sini
+        const char* awalPanjang = awalData + ukuranSumber;
+        const char* isi = awalPanjang + header.jumlahString * sizeof(uint32_t);
+        const char* akhirString = awalData + ukuranSumber + header.ukuranString;
+        
+        daftarString = new string[header.jumlahString];
+        for (uint32_t i = 0; i < header.jumlahString; i++) {
+            uint32_t panjang;
+            memcpy(&panjang, awalPanjang + i * sizeof(uint32_t), sizeof(panjang));
+            
+            if (panjang > (size_t)(akhirString - isi)) {
+                cout << "[ERROR] Snapshot rusak, memuat dari file teks..." << endl;
+                tutup();
+                return false;
+            }
+            
+            daftarString[i].assign(isi, panjang);
+            isi += panjang;
+        }
+        
+        posisi = akhirString;
+        akhir = posisi + header.ukuranBodi;
+        gagalBaca = false;
+        return true;
+    }
+    
+    // Jumlah record suatu bagian
+    uint32_t getJumlahData(BagianSnapshot bagian) const {
+        return header.jumlahData[static_cast<int>(bagian)];
+    }
+    
+    // Baca satu nilai fixed-width
+    template<typename T>
+    T baca() {
+        T nilai = T();
+        
+        if (posisi == nullptr || (size_t)(akhir - posisi) < sizeof(T)) {
+            gagalBaca = true;
+            return nilai;
+        }
+        
+        memcpy(&nilai, posisi, sizeof(T));
+        posisi += sizeof(T);
+        return nilai;
+    }
+    
+    // Baca string (index ke tabel string)
+    const string& bacaString() {
+        static const string KOSONG;
+        
+        uint32_t index = baca<uint32_t>();
+        if (index >= header.jumlahString) {
+            gagalBaca = true;
+            return KOSONG;
+        }
+        
+        return daftarString[index];
+    }
+    
+    // Cek apakah ada pembacaan di luar batas / index tidak valid
+    bool gagal() const {
+        return gagalBaca;
+    }
+};
+
+#endif
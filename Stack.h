@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
+#include "AlokatorNode.h"
 using namespace std;
 
 // ============================================================================
@@ -17,15 +19,17 @@ struct StackNode {
     T data;
     StackNode<T>* next;
     
-    StackNode(const T& nilai) : data(nilai), next(nullptr) {}
+    template<typename... Args>
+    StackNode(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alokator = AlokatorPool<StackNode<T> > >
 class Stack {
 private:
     StackNode<T>* top;
     int jumlahItem;
     int maksimalKapasitas; // Batas maksimal untuk prevent memory overflow
+    Alokator alokator;
 
 public:
     // Constructor
@@ -56,13 +60,23 @@ public:
     
     // Push - Tambah data ke top stack
     bool push(const T& data) {
+        return pushBaru(data);
+    }
+    
+    bool push(T&& data) {
+        return pushBaru(std::move(data));
+    }
+    
+    // Push dengan data dibangun langsung di node (emplace)
+    template<typename... Args>
+    bool pushBaru(Args&&... args) {
         if (penuh()) {
             cout << "[STACK PENUH] Tidak dapat menambah data. Max: " 
                  << maksimalKapasitas << endl;
             return false;
         }
         
-        StackNode<T>* nodeBaru = new StackNode<T>(data);
+        StackNode<T>* nodeBaru = alokator.alokasi(std::forward<Args>(args)...);
         nodeBaru->next = top;
         top = nodeBaru;
         jumlahItem++;
@@ -80,7 +94,7 @@ public:
         dataKeluar = top->data;
         top = top->next;
         
-        delete temp;
+        alokator.dealokasi(temp);
         jumlahItem--;
         
         return true;
@@ -95,7 +109,7 @@ public:
         StackNode<T>* temp = top;
         top = top->next;
         
-        delete temp;
+        alokator.dealokasi(temp);
         jumlahItem--;
         
         return true;
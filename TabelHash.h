@@ -0,0 +1,219 @@
+#ifndef TABEL_HASH_H
+#define TABEL_HASH_H
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+using namespace std;
+
+// ============================================================================
+// TABEL HASH - OPEN ADDRESSING (LINEAR PROBING)
+// ============================================================================
+// Digunakan untuk index pencarian O(1) dengan key string
+// Contoh penggunaan: cari pengguna by ID / email / nama
+// - Hash FNV-1a, kapasitas selalu pangkat 2
+// - Slot yang dihapus ditandai (tombstone) agar probing tetap benar
+// - Tabel diperbesar 2x saat slot terpakai > 70%
+// Interface mengikuti BinarySearchTree: insert, search, hapus, clear, iterasi
+// ============================================================================
+
+template<typename T>
+class TabelHash {
+private:
+    enum class StatusSlot { KOSONG, TERISI, DIHAPUS };
+    
+    struct Slot {
+        string key;
+        T data;
+        StatusSlot status;
+        
+        Slot() : data(), status(StatusSlot::KOSONG) {}
+    };
+    
+    static const int KAPASITAS_AWAL = 16;
+    
+    Slot* daftarSlot;
+    int kapasitas;
+    int jumlahData;      // Slot TERISI
+    int jumlahTerpakai;  // Slot TERISI + DIHAPUS
+    
+    // Helper: Hash FNV-1a 32-bit
+    static uint32_t hashKunci(const string& key) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < key.length(); i++) {
+            hash ^= (unsigned char)key[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+    
+    // Helper: Index slot berisi key, -1 jika tidak ada
+    int cariSlot(const string& key) const {
+        if (daftarSlot == nullptr) return -1;
+        
+        int mask = kapasitas - 1;
+        int i = hashKunci(key) & mask;
+        
+        while (daftarSlot[i].status != StatusSlot::KOSONG) {
+            if (daftarSlot[i].status == StatusSlot::TERISI && daftarSlot[i].key == key) {
+                return i;
+            }
+            i = (i + 1) & mask;
+        }
+        
+        return -1;
+    }
+    
+    // Helper: Alokasi ulang tabel dan masukkan kembali semua data
+    // Tombstone ikut dibuang
+    void rehash(int kapasitasBaru) {
+        Slot* slotLama = daftarSlot;
+        int kapasitasLama = kapasitas;
+        
+        daftarSlot = new Slot[kapasitasBaru];
+        kapasitas = kapasitasBaru;
+        jumlahTerpakai = jumlahData;
+        
+        int mask = kapasitas - 1;
+        for (int i = 0; i < kapasitasLama; i++) {
+            if (slotLama[i].status != StatusSlot::TERISI) continue;
+            
+            int j = hashKunci(slotLama[i].key) & mask;
+            while (daftarSlot[j].status != StatusSlot::KOSONG) {
+                j = (j + 1) & mask;
+            }
+            
+            daftarSlot[j].key.swap(slotLama[i].key);
+            daftarSlot[j].data = slotLama[i].data;
+            daftarSlot[j].status = StatusSlot::TERISI;
+        }
+        
+        delete[] slotLama;
+    }
+
+public:
+    // Constructor
+    TabelHash()
+        : daftarSlot(nullptr), kapasitas(0), jumlahData(0), jumlahTerpakai(0) {}
+    
+    // Destructor
+    ~TabelHash() {
+        delete[] daftarSlot;
+    }
+    
+    // Index dimiliki oleh satu modul, tidak boleh di-copy
+    TabelHash(const TabelHash&) = delete;
+    TabelHash& operator=(const TabelHash&) = delete;
+    
+    // Cek apakah tabel kosong
+    bool kosong() const {
+        return jumlahData == 0;
+    }
+    
+    // Dapatkan jumlah data
+    int ukuran() const {
+        return jumlahData;
+    }
+    
+    // Siapkan kapasitas untuk n data (menghindari rehash berulang saat load)
+    void reservasi(int n) {
+        int kapasitasBaru = (kapasitas == 0) ? KAPASITAS_AWAL : kapasitas;
+        while ((long long)n * 10 > (long long)kapasitasBaru * 7) {
+            kapasitasBaru *= 2;
+        }
+        
+        if (kapasitasBaru != kapasitas) {
+            rehash(kapasitasBaru);
+        }
+    }
+    
+    // Insert data dengan key (key sudah ada: data di-update)
+    void insert(const T& data, const string& key) {
+        // Jaga load factor (termasuk tombstone) di bawah 70%
+        if ((long long)(jumlahTerpakai + 1) * 10 > (long long)kapasitas * 7) {
+            if (kapasitas == 0) {
+                rehash(KAPASITAS_AWAL);
+            } else if ((long long)(jumlahData + 1) * 10 > (long long)kapasitas * 7 / 2) {
+                rehash(kapasitas * 2);
+            } else {
+                rehash(kapasitas); // Banyak tombstone, cukup dibersihkan
+            }
+        }
+        
+        int mask = kapasitas - 1;
+        int i = hashKunci(key) & mask;
+        int tombstone = -1;
+        
+        while (daftarSlot[i].status != StatusSlot::KOSONG) {
+            if (daftarSlot[i].status == StatusSlot::TERISI) {
+                if (daftarSlot[i].key == key) {
+                    daftarSlot[i].data = data;
+                    return;
+                }
+            } else if (tombstone < 0) {
+                tombstone = i;
+            }
+            i = (i + 1) & mask;
+        }
+        
+        // Pakai ulang tombstone pertama jika ada
+        if (tombstone >= 0) {
+            i = tombstone;
+        } else {
+            jumlahTerpakai++;
+        }
+        
+        daftarSlot[i].key = key;
+        daftarSlot[i].data = data;
+        daftarSlot[i].status = StatusSlot::TERISI;
+        jumlahData++;
+    }
+    
+    // Search data berdasarkan key
+    T* search(const string& key) {
+        int i = cariSlot(key);
+        return (i >= 0) ? &daftarSlot[i].data : nullptr;
+    }
+    
+    // Search const version
+    const T* search(const string& key) const {
+        int i = cariSlot(key);
+        return (i >= 0) ? &daftarSlot[i].data : nullptr;
+    }
+    
+    // Hapus data berdasarkan key
+    bool hapus(const string& key) {
+        int i = cariSlot(key);
+        if (i < 0) return false;
+        
+        daftarSlot[i].key.clear();
+        daftarSlot[i].data = T();
+        daftarSlot[i].status = StatusSlot::DIHAPUS;
+        jumlahData--;
+        return true;
+    }
+    
+    // Clear semua data (kapasitas tetap dipakai ulang)
+    void clear() {
+        for (int i = 0; i < kapasitas; i++) {
+            daftarSlot[i].key.clear();
+            daftarSlot[i].data = T();
+            daftarSlot[i].status = StatusSlot::KOSONG;
+        }
+        
+        jumlahData = 0;
+        jumlahTerpakai = 0;
+    }
+    
+    // Iterasi semua data (urutan tidak terdefinisi)
+    template<typename Function>
+    void iterasi(Function func) {
+        for (int i = 0; i < kapasitas; i++) {
+            if (daftarSlot[i].status == StatusSlot::TERISI) {
+                func(daftarSlot[i].data);
+            }
+        }
+    }
+};
+
+#endif
@@ -3,7 +3,9 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include "PengelolaFile.h"
+#include "ArrayKecil.h"
 #include "Kamar.h"
 #include "Layanan.h"
 using namespace std;
@@ -42,32 +44,33 @@ private:
     JenisItem jenis;
     string idItem;          // ID kamar atau ID layanan
     string namaItem;        // Nama untuk display
-    double hargaSatuan;
+    Rupiah hargaSatuan;
     int kuantitas;          // Jumlah malam (kamar) atau jumlah unit (layanan)
-    double subtotal;
+    Rupiah subtotal;
     string tanggalMulai;    // DD/MM/YYYY
     string tanggalSelesai;  // DD/MM/YYYY (untuk kamar)
     string keterangan;      // Optional notes
 
 public:
     // Constructor UNIFIED dengan parameter jenis eksplisit
+    // Argumen string by value lalu di-move (sink), lihat Pengguna
     ItemBooking(JenisItem _jenis,
-                const string& _id, const string& _nama, 
-                double _harga, int _kuantitas,
-                const string& _tanggalMulai, 
-                const string& _tanggalSelesai = "",
-                const string& _ket = "")
-        : jenis(_jenis), idItem(_id), namaItem(_nama),
+                string _id, string _nama, 
+                const Rupiah& _harga, int _kuantitas,
+                string _tanggalMulai, 
+                string _tanggalSelesai = "",
+                string _ket = "")
+        : jenis(_jenis), idItem(std::move(_id)), namaItem(std::move(_nama)),
           hargaSatuan(_harga), kuantitas(_kuantitas),
-          tanggalMulai(_tanggalMulai), tanggalSelesai(_tanggalSelesai),
-          keterangan(_ket) {
+          tanggalMulai(std::move(_tanggalMulai)), tanggalSelesai(std::move(_tanggalSelesai)),
+          keterangan(std::move(_ket)) {
         subtotal = hargaSatuan * kuantitas;
     }
     
     // Static factory methods untuk kemudahan penggunaan
     static ItemBooking* buatBookingKamar(
         const string& idKamar, const string& namaKamar,
-        double harga, int jumlahMalam,
+        const Rupiah& harga, int jumlahMalam,
         const string& checkin, const string& checkout,
         const string& keterangan = "") {
         
@@ -77,7 +80,7 @@ public:
     
     static ItemBooking* buatBookingLayanan(
         const string& idLayanan, const string& namaLayanan,
-        double harga, int kuantitas, const string& tanggal,
+        const Rupiah& harga, int kuantitas, const string& tanggal,
         const string& keterangan = "") {
         
         return new ItemBooking(JenisItem::LAYANAN, idLayanan, namaLayanan,
@@ -86,14 +89,14 @@ public:
     
     // Getter
     JenisItem getJenis() const { return jenis; }
-    string getIdItem() const { return idItem; }
-    string getNamaItem() const { return namaItem; }
-    double getHargaSatuan() const { return hargaSatuan; }
+    const string& getIdItem() const { return idItem; }
+    const string& getNamaItem() const { return namaItem; }
+    Rupiah getHargaSatuan() const { return hargaSatuan; }
     int getKuantitas() const { return kuantitas; }
-    double getSubtotal() const { return subtotal; }
-    string getTanggalMulai() const { return tanggalMulai; }
-    string getTanggalSelesai() const { return tanggalSelesai; }
-    string getKeterangan() const { return keterangan; }
+    Rupiah getSubtotal() const { return subtotal; }
+    const string& getTanggalMulai() const { return tanggalMulai; }
+    const string& getTanggalSelesai() const { return tanggalSelesai; }
+    const string& getKeterangan() const { return keterangan; }
     
     // Setter
     void setKuantitas(int _kuantitas) {
@@ -101,7 +104,7 @@ public:
         subtotal = hargaSatuan * kuantitas;
     }
     
-    void setKeterangan(const string& _ket) { keterangan = _ket; }
+    void setKeterangan(string _ket) { keterangan = std::move(_ket); }
     
     // Helper
     string getJenisString() const {
@@ -144,9 +147,9 @@ public:
         fields[0] = getJenisString();
         fields[1] = idItem;
         fields[2] = namaItem;
-        fields[3] = to_string(static_cast<long long>(hargaSatuan));
+        fields[3] = hargaSatuan.toString();
         fields[4] = to_string(kuantitas);
-        fields[5] = to_string(static_cast<long long>(subtotal));
+        fields[5] = subtotal.toString();
         fields[6] = tanggalMulai;
         fields[7] = tanggalSelesai;
         fields[8] = keterangan;
@@ -166,112 +169,88 @@ private:
     StatusTransaksi status;
     MetodePembayaran metodeBayar;
     
-    // Array untuk menyimpan items (max 20 items per transaksi)
-    ItemBooking* items[20];
-    int jumlahItem;
+    // Item disimpan by value: ITEM_INLINE item pertama di dalam objek,
+    // sisanya pindah ke satu buffer heap. Tidak ada batas jumlah item
+    // 1 item inline (~184 byte) hampir sama dengan 20 pointer lama (160 byte)
+    static const int ITEM_INLINE = 1;
+    ArrayKecil<ItemBooking, ITEM_INLINE> items;
+    int jumlahItem;     // Bisa > items.ukuran() sampai item hasil load dimuat
     
-    double totalHarga;
-    double pajak;           // 10% dari total
-    double biayaLayanan;    // 5% dari total
-    double totalAkhir;
+    Rupiah totalHarga;
+    Rupiah pajak;           // 10% dari total
+    Rupiah biayaLayanan;    // 5% dari total
+    Rupiah totalAkhir;
     
     string tanggalTransaksi;
     string tanggalCheckIn;
     string tanggalCheckOut;
     string catatan;
     
-    // Helper untuk hitung total
+    // Helper untuk hitung pajak, service & total akhir dari totalHarga
+    // (totalHarga diperbarui per item saat tambah/hapus, bukan dijumlah ulang)
     void hitungTotal() {
-        totalHarga = 0.0;
-        for (int i = 0; i < jumlahItem; i++) {
-            totalHarga += items[i]->getSubtotal();
-        }
-        
-        pajak = totalHarga * 0.10;          // PPN 10%
-        biayaLayanan = totalHarga * 0.05;   // Service charge 5%
+        pajak = totalHarga.persen(PERSEN_PAJAK);
+        biayaLayanan = totalHarga.persen(PERSEN_LAYANAN);
         totalAkhir = totalHarga + pajak + biayaLayanan;
     }
 
 public:
+    static const int PERSEN_PAJAK = 10;     // PPN 10%
+    static const int PERSEN_LAYANAN = 5;    // Service charge 5%
+    
     // Constructor
-    Transaksi(const string& _idTransaksi, const string& _idPelanggan,
-              const string& _namaPelanggan, const string& _tanggalTransaksi)
-        : idTransaksi(_idTransaksi), idPelanggan(_idPelanggan),
-          namaPelanggan(_namaPelanggan), status(StatusTransaksi::PENDING),
+    Transaksi(string _idTransaksi, string _idPelanggan,
+              string _namaPelanggan, string _tanggalTransaksi)
+        : idTransaksi(std::move(_idTransaksi)), idPelanggan(std::move(_idPelanggan)),
+          namaPelanggan(std::move(_namaPelanggan)), status(StatusTransaksi::PENDING),
           metodeBayar(MetodePembayaran::TUNAI), jumlahItem(0),
-          totalHarga(0.0), pajak(0.0), biayaLayanan(0.0), totalAkhir(0.0),
-          tanggalTransaksi(_tanggalTransaksi), tanggalCheckIn(""),
-          tanggalCheckOut(""), catatan("") {
-        
-        // Inisialisasi array items
-        for (int i = 0; i < 20; i++) {
-            items[i] = nullptr;
-        }
-    }
+          totalHarga(), pajak(), biayaLayanan(), totalAkhir(),
+          tanggalTransaksi(std::move(_tanggalTransaksi)), tanggalCheckIn(""),
+          tanggalCheckOut(""), catatan("") {}
     
-    // Destructor - hapus semua items untuk prevent memory leak
-    ~Transaksi() {
-        for (int i = 0; i < jumlahItem; i++) {
-            delete items[i];
-            items[i] = nullptr;
-        }
-    }
-    
-    // Copy constructor (deep copy)
-    Transaksi(const Transaksi& other)
-        : idTransaksi(other.idTransaksi), idPelanggan(other.idPelanggan),
-          namaPelanggan(other.namaPelanggan), status(other.status),
-          metodeBayar(other.metodeBayar), jumlahItem(other.jumlahItem),
-          totalHarga(other.totalHarga), pajak(other.pajak),
-          biayaLayanan(other.biayaLayanan), totalAkhir(other.totalAkhir),
-          tanggalTransaksi(other.tanggalTransaksi),
-          tanggalCheckIn(other.tanggalCheckIn),
-          tanggalCheckOut(other.tanggalCheckOut), catatan(other.catatan) {
-        
-        // Deep copy items
-        for (int i = 0; i < 20; i++) {
-            if (i < other.jumlahItem && other.items[i] != nullptr) {
-                items[i] = new ItemBooking(*other.items[i]);
-            } else {
-                items[i] = nullptr;
-            }
-        }
-    }
+    // Copy & move: item ikut di-copy/di-move oleh ArrayKecil
+    Transaksi(const Transaksi&) = default;
+    Transaksi(Transaksi&&) = default;
+    Transaksi& operator=(const Transaksi&) = default;
+    Transaksi& operator=(Transaksi&&) = default;
     
     // Getter
-    string getIdTransaksi() const { return idTransaksi; }
-    string getIdPelanggan() const { return idPelanggan; }
-    string getNamaPelanggan() const { return namaPelanggan; }
+    const string& getIdTransaksi() const { return idTransaksi; }
+    const string& getIdPelanggan() const { return idPelanggan; }
+    const string& getNamaPelanggan() const { return namaPelanggan; }
     StatusTransaksi getStatus() const { return status; }
     MetodePembayaran getMetodeBayar() const { return metodeBayar; }
     int getJumlahItem() const { return jumlahItem; }
-    double getTotalHarga() const { return totalHarga; }
-    double getPajak() const { return pajak; }
-    double getBiayaLayanan() const { return biayaLayanan; }
-    double getTotalAkhir() const { return totalAkhir; }
-    string getTanggalTransaksi() const { return tanggalTransaksi; }
-    string getTanggalCheckIn() const { return tanggalCheckIn; }
-    string getTanggalCheckOut() const { return tanggalCheckOut; }
-    string getCatatan() const { return catatan; }
+    Rupiah getTotalHarga() const { return totalHarga; }
+    Rupiah getPajak() const { return pajak; }
+    Rupiah getBiayaLayanan() const { return biayaLayanan; }
+    Rupiah getTotalAkhir() const { return totalAkhir; }
+    const string& getTanggalTransaksi() const { return tanggalTransaksi; }
+    const string& getTanggalCheckIn() const { return tanggalCheckIn; }
+    const string& getTanggalCheckOut() const { return tanggalCheckOut; }
+    const string& getCatatan() const { return catatan; }
     
     // Setter khusus untuk loading dari file (persistence)
-    void setTotalDariFile(double _totalHarga, double _pajak, double _biayaLayanan, double _totalAkhir) {
+    void setTotalDariFile(const Rupiah& _totalHarga, const Rupiah& _pajak,
+                          const Rupiah& _biayaLayanan, const Rupiah& _totalAkhir) {
         totalHarga = _totalHarga;
         pajak = _pajak;
         biayaLayanan = _biayaLayanan;
         totalAkhir = _totalAkhir;
     }
     
+    // Item belum ada di memori, dimuat belakangan lewat pasangItemDariFile
     void setJumlahItemDariFile(int jumlah) {
-        jumlahItem = jumlah;
+        jumlahItem = (jumlah < 0) ? 0 : jumlah;
     }
     
     // Setter
+    void setIdTransaksi(string _id) { idTransaksi = std::move(_id); }
     void setStatus(StatusTransaksi _status) { status = _status; }
     void setMetodeBayar(MetodePembayaran _metode) { metodeBayar = _metode; }
-    void setTanggalCheckIn(const string& _tanggal) { tanggalCheckIn = _tanggal; }
-    void setTanggalCheckOut(const string& _tanggal) { tanggalCheckOut = _tanggal; }
-    void setCatatan(const string& _catatan) { catatan = _catatan; }
+    void setTanggalCheckIn(string _tanggal) { tanggalCheckIn = std::move(_tanggal); }
+    void setTanggalCheckOut(string _tanggal) { tanggalCheckOut = std::move(_tanggal); }
+    void setCatatan(string _catatan) { catatan = std::move(_catatan); }
     
     // Helper: Convert status ke string
     string getStatusString() const {
@@ -286,7 +265,12 @@ public:
     
     // Helper: Convert metode bayar ke string
     string getMetodeBayarString() const {
-        switch (metodeBayar) {
+        return metodeKeString(metodeBayar);
+    }
+    
+    // Helper: Static function - MetodePembayaran ke string
+    static string metodeKeString(MetodePembayaran metode) {
+        switch (metode) {
             case MetodePembayaran::TUNAI: return "TUNAI";
             case MetodePembayaran::TRANSFER_BANK: return "TRANSFER_BANK";
             case MetodePembayaran::KARTU_KREDIT: return "KARTU_KREDIT";
@@ -295,44 +279,64 @@ public:
         }
     }
     
-    // Tambah item ke transaksi
-    bool tambahItem(ItemBooking* item) {
-        if (jumlahItem >= 20) {
-            cout << "[ERROR] Transaksi penuh! Maksimal 20 item." << endl;
-            return false;
-        }
-        
-        items[jumlahItem++] = item;
+    // Siapkan tempat untuk n item (satu kali alokasi untuk booking besar)
+    void reservasiItem(int n) {
+        items.reservasi(n);
+    }
+    
+    // Tambah item ke transaksi (item di-move, tidak di-copy)
+    void tambahItem(ItemBooking&& item) {
+        totalHarga += item.getSubtotal();
+        items.tambah(std::move(item));
+        jumlahItem = items.ukuran();
         hitungTotal();
-        return true;
+    }
+    
+    void tambahItem(const ItemBooking& item) {
+        tambahItem(ItemBooking(item));
     }
     
     // Hapus item by index
     bool hapusItem(int index) {
-        if (index < 0 || index >= jumlahItem) {
+        const ItemBooking* item = items.dapatkan(index);
+        if (item == nullptr) {
             return false;
         }
         
-        delete items[index];
-        
-        // Shift items ke kiri
-        for (int i = index; i < jumlahItem - 1; i++) {
-            items[i] = items[i + 1];
-        }
-        
-        items[jumlahItem - 1] = nullptr;
-        jumlahItem--;
+        totalHarga -= item->getSubtotal();
+        items.hapus(index);
+        jumlahItem = items.ukuran();
         
         hitungTotal();
         return true;
     }
     
     // Dapatkan item by index
-    ItemBooking* getItem(int index) const {
-        if (index < 0 || index >= jumlahItem) {
-            return nullptr;
+    // Transaksi hasil load: nullptr sampai item dimuat (lihat pasangItemDariFile)
+    const ItemBooking* getItem(int index) const {
+        return items.dapatkan(index);
+    }
+    
+    // Pindahkan isi item keluar dari transaksi (dipakai keranjang saat
+    // checkout batal). Item yang tersisa kosong, transaksi tidak dipakai lagi
+    ItemBooking lepasItem(int index) {
+        return std::move(*items.dapatkan(index));
+    }
+    
+    // Pasang item hasil load sesudah item yang sudah ada (total tidak dihitung
+    // ulang, sudah dari file). false jika jumlah item di file sudah terpenuhi
+    bool pasangItemDariFile(ItemBooking&& item) {
+        if (items.ukuran() >= jumlahItem) {
+            return false;
         }
-        return items[index];
+        
+        items.tambah(std::move(item));
+        return true;
+    }
+    
+    // Cek apakah semua item sudah ada di memori
+    bool isItemLengkap() const {
+        return items.ukuran() >= jumlahItem;
     }
     
     // Tampilkan struk/invoice
@@ -349,15 +353,15 @@ public:
         cout << " DETAIL ITEM:                                               " << endl;
         cout << "------------------------------------------------------------" << endl;
         
-        for (int i = 0; i < jumlahItem; i++) {
+        for (int i = 0; i < items.ukuran(); i++) {
             cout << " " << (i + 1) << ". ";
-            string itemStr = items[i]->getNamaItem();
+            string itemStr = items[i].getNamaItem();
             if (itemStr.length() > 50) itemStr = itemStr.substr(0, 47) + "...";
             cout << itemStr << string(54 - itemStr.length(), ' ') << "" << endl;
             
-            string detail = "    " + to_string(items[i]->getKuantitas()) + " x " + 
-                           PengelolaFile::formatRupiah(items[i]->getHargaSatuan()) +
-                           " = " + PengelolaFile::formatRupiah(items[i]->getSubtotal());
+            string detail = "    " + to_string(items[i].getKuantitas()) + " x " + 
+                           PengelolaFile::formatRupiah(items[i].getHargaSatuan()) +
+                           " = " + PengelolaFile::formatRupiah(items[i].getSubtotal());
             if (detail.length() > 56) detail = detail.substr(0, 53) + "...";
             cout << " " << detail << string(57 - detail.length(), ' ') << "" << endl;
         }